@@ -122,6 +122,15 @@ ResourceUID::ID ResourceLoader::get_resource_uid(const String &p_path) {
 	return ::ResourceLoader::get_resource_uid(p_path);
 }
 
+void ResourceLoader::set_cache_retention_budget(int64_t p_bytes) {
+	ERR_FAIL_COND(p_bytes < 0);
+	ResourceCache::set_retention_budget(p_bytes);
+}
+
+int64_t ResourceLoader::get_cache_retention_budget() const {
+	return ResourceCache::get_retention_budget();
+}
+
 void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load_threaded_request", "path", "type_hint", "use_sub_threads", "cache_mode"), &ResourceLoader::load_threaded_request, DEFVAL(""), DEFVAL(false), DEFVAL(CACHE_MODE_REUSE));
 	ClassDB::bind_method(D_METHOD("load_threaded_get_status", "path", "progress"), &ResourceLoader::load_threaded_get_status, DEFVAL(Array()));
@@ -136,6 +145,8 @@ void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("has_cached", "path"), &ResourceLoader::has_cached);
 	ClassDB::bind_method(D_METHOD("exists", "path", "type_hint"), &ResourceLoader::exists, DEFVAL(""));
 	ClassDB::bind_method(D_METHOD("get_resource_uid", "path"), &ResourceLoader::get_resource_uid);
+	ClassDB::bind_method(D_METHOD("set_cache_retention_budget", "bytes"), &ResourceLoader::set_cache_retention_budget);
+	ClassDB::bind_method(D_METHOD("get_cache_retention_budget"), &ResourceLoader::get_cache_retention_budget);
 
 	BIND_ENUM_CONSTANT(THREAD_LOAD_INVALID_RESOURCE);
 	BIND_ENUM_CONSTANT(THREAD_LOAD_IN_PROGRESS);
@@ -85,6 +85,8 @@ public:
 	bool has_cached(const String &p_path);
 	bool exists(const String &p_path, const String &p_type_hint = "");
 	ResourceUID::ID get_resource_uid(const String &p_path);
+	void set_cache_retention_budget(int64_t p_bytes);
+	int64_t get_cache_retention_budget() const;
 
 	ResourceLoader() { singleton = this; }
 };
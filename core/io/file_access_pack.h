@@ -120,6 +120,7 @@ public:
 
 	_FORCE_INLINE_ Ref<FileAccess> try_open_path(const String &p_path);
 	_FORCE_INLINE_ bool has_path(const String &p_path);
+	_FORCE_INLINE_ bool get_path_offset(const String &p_path, String *r_pack, uint64_t *r_offset);
 
 	_FORCE_INLINE_ Ref<DirAccess> try_open_directory(const String &p_path);
 	_FORCE_INLINE_ bool has_directory(const String &p_path);
@@ -208,6 +209,16 @@ bool PackedData::has_path(const String &p_path) {
 	return files.has(PathMD5(p_path.simplify_path().md5_buffer()));
 }
 
+bool PackedData::get_path_offset(const String &p_path, String *r_pack, uint64_t *r_offset) {
+	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(PathMD5(p_path.simplify_path().md5_buffer()));
+	if (!E || E->value.offset == 0) {
+		return false;
+	}
+	*r_pack = E->value.pack;
+	*r_offset = E->value.offset;
+	return true;
+}
+
 bool PackedData::has_directory(const String &p_path) {
 	Ref<DirAccess> da = try_open_directory(p_path);
 	if (da.is_valid()) {
@@ -2146,6 +2146,10 @@ Vector<uint8_t> Image::get_data() const {
 	return data;
 }
 
+uint64_t Image::estimate_memory_usage() const {
+	return sizeof(Image) + data.size();
+}
+
 Ref<Image> Image::create_empty(int p_width, int p_height, bool p_use_mipmaps, Format p_format) {
 	Ref<Image> image;
 	image.instantiate();
@@ -61,10 +61,19 @@ void Resource::set_path(const String &p_path, bool p_take_over) {
 		p_take_over = false; // Can't take over an empty path
 	}
 
-	ResourceCache::lock.lock();
+	// Both shards are held while the resource moves, so it can't be missing from the cache in between.
+	// Different shards are locked in address order, so resources moving the opposite way can't deadlock.
+	ResourceCache::Shard *shard = &ResourceCache::_get_shard(p_path);
+	ResourceCache::Shard *old_shard = path_cache.is_empty() ? shard : &ResourceCache::_get_shard(path_cache);
+	ResourceCache::Shard *first_shard = MIN(shard, old_shard);
+	ResourceCache::Shard *second_shard = MAX(shard, old_shard);
+	first_shard->mutex.lock();
+	if (second_shard != first_shard) {
+		second_shard->mutex.lock();
+	}
 
 	if (!path_cache.is_empty()) {
-		ResourceCache::resources.erase(path_cache);
+		old_shard->resources.erase(path_cache);
 	}
 
 	path_cache = "";
@@ -74,9 +83,12 @@ void Resource::set_path(const String &p_path, bool p_take_over) {
 	if (existing.is_valid()) {
 		if (p_take_over) {
 			existing->path_cache = String();
-			ResourceCache::resources.erase(p_path);
+			shard->resources.erase(p_path);
 		} else {
-			ResourceCache::lock.unlock();
+			if (second_shard != first_shard) {
+				second_shard->mutex.unlock();
+			}
+			first_shard->mutex.unlock();
 			ERR_FAIL_MSG("Another resource is loaded from path '" + p_path + "' (possible cyclic resource inclusion).");
 		}
 	}
@@ -84,9 +96,12 @@ void Resource::set_path(const String &p_path, bool p_take_over) {
 	path_cache = p_path;
 
 	if (!path_cache.is_empty()) {
-		ResourceCache::resources[path_cache] = this;
+		shard->resources[path_cache] = this;
 	}
-	ResourceCache::lock.unlock();
+	if (second_shard != first_shard) {
+		second_shard->mutex.unlock();
+	}
+	first_shard->mutex.unlock();
 
 	_resource_path_changed();
 }
@@ -416,6 +431,11 @@ void Resource::_take_over_path(const String &p_path) {
 	set_path(p_path, true);
 }
 
+uint64_t Resource::estimate_memory_usage() const {
+	// Rough figure for resources that don't know better, types holding large buffers override this.
+	return 1024;
+}
+
 RID Resource::get_rid() const {
 	if (get_script_instance()) {
 		Callable::CallError ce;
@@ -571,13 +591,14 @@ Resource::Resource() :
 
 Resource::~Resource() {
 	if (!path_cache.is_empty()) {
-		ResourceCache::lock.lock();
-		ResourceCache::resources.erase(path_cache);
-		ResourceCache::lock.unlock();
+		ResourceCache::Shard &shard = ResourceCache::_get_shard(path_cache);
+		shard.mutex.lock();
+		shard.resources.erase(path_cache);
+		shard.mutex.unlock();
 	}
 }
 
-HashMap<String, Resource *> ResourceCache::resources;
+ResourceCache::Shard ResourceCache::shards[ResourceCache::SHARD_COUNT];
 #ifdef TOOLS_ENABLED
 HashMap<String, HashMap<String, String>> ResourceCache::resource_path_cache;
 #endif
@@ -587,34 +608,48 @@ Mutex ResourceCache::lock;
 RWLock ResourceCache::path_cache_lock;
 #endif
 
+Mutex ResourceCache::retention_mutex;
+List<ResourceCache::Retained> ResourceCache::retained;
+HashMap<Resource *, List<ResourceCache::Retained>::Element *> ResourceCache::retained_map;
+SafeNumeric<uint64_t> ResourceCache::retention_budget;
+uint64_t ResourceCache::retained_memory = 0;
+
 void ResourceCache::clear() {
-	if (!resources.is_empty()) {
+	clear_retained();
+
+	int count = get_cached_resource_count();
+	if (count) {
 		if (OS::get_singleton()->is_stdout_verbose()) {
-			ERR_PRINT(vformat("%d resources still in use at exit.", resources.size()));
-			for (const KeyValue<String, Resource *> &E : resources) {
-				print_line(vformat("Resource still in use: %s (%s)", E.key, E.value->get_class()));
+			ERR_PRINT(vformat("%d resources still in use at exit.", count));
+			for (const Shard &shard : shards) {
+				for (const KeyValue<String, Resource *> &E : shard.resources) {
+					print_line(vformat("Resource still in use: %s (%s)", E.key, E.value->get_class()));
+				}
 			}
 		} else {
-			ERR_PRINT(vformat("%d resources still in use at exit (run with --verbose for details).", resources.size()));
+			ERR_PRINT(vformat("%d resources still in use at exit (run with --verbose for details).", count));
 		}
 	}
 
-	resources.clear();
+	for (Shard &shard : shards) {
+		shard.resources.clear();
+	}
 }
 
 bool ResourceCache::has(const String &p_path) {
-	lock.lock();
+	Shard &shard = _get_shard(p_path);
+	shard.mutex.lock();
 
-	Resource **res = resources.getptr(p_path);
+	Resource **res = shard.resources.getptr(p_path);
 
 	if (res && (*res)->get_reference_count() == 0) {
 		// This resource is in the process of being deleted, ignore its existence.
 		(*res)->path_cache = String();
-		resources.erase(p_path);
+		shard.resources.erase(p_path);
 		res = nullptr;
 	}
 
-	lock.unlock();
+	shard.mutex.unlock();
 
 	if (!res) {
 		return false;
@@ -625,9 +660,10 @@ bool ResourceCache::has(const String &p_path) {
 
 Ref<Resource> ResourceCache::get_ref(const String &p_path) {
 	Ref<Resource> ref;
-	lock.lock();
+	Shard &shard = _get_shard(p_path);
+	shard.mutex.lock();
 
-	Resource **res = resources.getptr(p_path);
+	Resource **res = shard.resources.getptr(p_path);
 
 	if (res) {
 		ref = Ref<Resource>(*res);
@@ -636,44 +672,149 @@ Ref<Resource> ResourceCache::get_ref(const String &p_path) {
 	if (res && !ref.is_valid()) {
 		// This resource is in the process of being deleted, ignore its existence
 		(*res)->path_cache = String();
-		resources.erase(p_path);
+		shard.resources.erase(p_path);
 		res = nullptr;
 	}
 
-	lock.unlock();
+	shard.mutex.unlock();
 
 	return ref;
 }
 
 void ResourceCache::get_cached_resources(List<Ref<Resource>> *p_resources) {
-	lock.lock();
-
 	LocalVector<String> to_remove;
 
-	for (KeyValue<String, Resource *> &E : resources) {
-		Ref<Resource> ref = Ref<Resource>(E.value);
+	for (Shard &shard : shards) {
+		shard.mutex.lock();
 
-		if (!ref.is_valid()) {
-			// This resource is in the process of being deleted, ignore its existence
-			E.value->path_cache = String();
-			to_remove.push_back(E.key);
-			continue;
+		for (KeyValue<String, Resource *> &E : shard.resources) {
+			Ref<Resource> ref = Ref<Resource>(E.value);
+
+			if (!ref.is_valid()) {
+				// This resource is in the process of being deleted, ignore its existence
+				E.value->path_cache = String();
+				to_remove.push_back(E.key);
+				continue;
+			}
+
+			p_resources->push_back(ref);
 		}
 
-		p_resources->push_back(ref);
-	}
+		for (const String &E : to_remove) {
+			shard.resources.erase(E);
+		}
+		to_remove.clear();
 
-	for (const String &E : to_remove) {
-		resources.erase(E);
+		shard.mutex.unlock();
 	}
-
-	lock.unlock();
 }
 
 int ResourceCache::get_cached_resource_count() {
-	lock.lock();
-	int rc = resources.size();
-	lock.unlock();
+	int rc = 0;
+	for (Shard &shard : shards) {
+		shard.mutex.lock();
+		rc += shard.resources.size();
+		shard.mutex.unlock();
+	}
 
 	return rc;
 }
+
+void ResourceCache::_evict_retained(LocalVector<Ref<Resource>> &r_evicted) {
+	List<Retained>::Element *E = retained.back();
+	while (E && retained_memory > retention_budget.get()) {
+		List<Retained>::Element *prev = E->prev();
+		// Dropping a resource that is still used elsewhere would not free anything, so only unreferenced ones are evicted.
+		if (E->get().resource->get_reference_count() == 1) {
+			retained_memory -= E->get().size;
+			retained_map.erase(E->get().resource.ptr());
+			r_evicted.push_back(E->get().resource);
+			retained.erase(E);
+		}
+		E = prev;
+	}
+}
+
+void ResourceCache::_trim_retained() {
+	// Releasing an evicted resource can drop the last outside reference to another retained one
+	// (e.g. a scene and its textures), so keep evicting until nothing else can be freed.
+	while (true) {
+		LocalVector<Ref<Resource>> evicted;
+		{
+			MutexLock mutex_lock(retention_mutex);
+			_evict_retained(evicted);
+		}
+		if (evicted.is_empty()) {
+			break;
+		}
+		// Evicted resources are released here, after unlocking, as freeing them takes the cache shard locks.
+	}
+}
+
+void ResourceCache::retain(const Ref<Resource> &p_resource) {
+	ERR_FAIL_COND(p_resource.is_null());
+
+	// Checked before locking, so cache hits don't contend on the retention mutex while retention is disabled.
+	if (retention_budget.get() == 0) {
+		return;
+	}
+
+	{
+		MutexLock mutex_lock(retention_mutex);
+		if (retention_budget.get() == 0) {
+			return;
+		}
+
+		List<Retained>::Element **E = retained_map.getptr(p_resource.ptr());
+		if (E) {
+			retained.move_to_front(*E);
+			return;
+		}
+
+		Retained r;
+		r.resource = p_resource;
+		r.size = p_resource->estimate_memory_usage();
+		retained_memory += r.size;
+		retained_map.insert(p_resource.ptr(), retained.push_front(r));
+	}
+
+	_trim_retained();
+}
+
+void ResourceCache::set_retention_budget(uint64_t p_bytes) {
+	if (p_bytes == 0) {
+		retention_mutex.lock();
+		retention_budget.set(0);
+		retention_mutex.unlock();
+		clear_retained();
+		return;
+	}
+
+	retention_budget.set(p_bytes);
+	_trim_retained();
+}
+
+uint64_t ResourceCache::get_retention_budget() {
+	return retention_budget.get();
+}
+
+int ResourceCache::get_retained_resource_count() {
+	MutexLock mutex_lock(retention_mutex);
+	return retained.size();
+}
+
+uint64_t ResourceCache::get_retained_memory() {
+	MutexLock mutex_lock(retention_mutex);
+	return retained_memory;
+}
+
+void ResourceCache::clear_retained() {
+	List<Retained> to_release;
+	{
+		MutexLock mutex_lock(retention_mutex);
+		to_release = retained;
+		retained.clear();
+		retained_map.clear();
+		retained_memory = 0;
+	}
+}
@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 
@@ -141,6 +142,7 @@ public:
 	void set_as_translation_remapped(bool p_remapped);
 
 	virtual RID get_rid() const; // some resources may offer conversion to RID
+	virtual uint64_t estimate_memory_usage() const; // Used to account retained resources against the ResourceCache budget.
 
 #ifdef TOOLS_ENABLED
 	//helps keep IDs same number when loading/saving scenes. -1 clears ID and it Returns -1 when no id stored
@@ -155,8 +157,30 @@ public:
 class ResourceCache {
 	friend class Resource;
 	friend class ResourceLoader; //need the lock
-	static Mutex lock;
-	static HashMap<String, Resource *> resources;
+	static Mutex lock; // Guards the translation remapped list.
+
+	// Paths are spread over several independently locked maps, so threads loading different resources rarely contend.
+	static constexpr uint32_t SHARD_COUNT = 16;
+	struct Shard {
+		Mutex mutex;
+		HashMap<String, Resource *> resources;
+	};
+	static Shard shards[SHARD_COUNT];
+	_FORCE_INLINE_ static Shard &_get_shard(const String &p_path) { return shards[p_path.hash() & (SHARD_COUNT - 1)]; }
+
+	// Optionally keeps recently loaded resources alive after their last user is gone, within a memory budget.
+	struct Retained {
+		Ref<Resource> resource;
+		uint64_t size = 0;
+	};
+	static Mutex retention_mutex;
+	static List<Retained> retained; // Most recently used first.
+	static HashMap<Resource *, List<Retained>::Element *> retained_map;
+	static SafeNumeric<uint64_t> retention_budget;
+	static uint64_t retained_memory;
+	static void _evict_retained(LocalVector<Ref<Resource>> &r_evicted);
+	static void _trim_retained();
+
 #ifdef TOOLS_ENABLED
 	static HashMap<String, HashMap<String, String>> resource_path_cache; // Each tscn has a set of resource paths and IDs.
 	static RWLock path_cache_lock;
@@ -170,6 +194,13 @@ public:
 	static Ref<Resource> get_ref(const String &p_path);
 	static void get_cached_resources(List<Ref<Resource>> *p_resources);
 	static int get_cached_resource_count();
+
+	static void retain(const Ref<Resource> &p_resource);
+	static void set_retention_budget(uint64_t p_bytes);
+	static uint64_t get_retention_budget();
+	static int get_retained_resource_count();
+	static uint64_t get_retained_memory();
+	static void clear_retained();
 };
 
 #endif // RESOURCE_H
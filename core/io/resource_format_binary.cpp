@@ -36,6 +36,7 @@
 #include "core/io/image.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
+#include "core/object/message_queue.h"
 #include "core/object/script_language.h"
 #include "core/version.h"
 
@@ -680,6 +681,157 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
+void ResourceLoaderBinary::_set_properties(PendingResource &p_pending) {
+	Resource *res = p_pending.resource.ptr();
+	Dictionary missing_resource_properties;
+
+	for (Pair<StringName, Variant> &E : p_pending.properties) {
+		const StringName &name = E.first;
+		Variant &value = E.second;
+
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && p_pending.missing_resource != nullptr) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
+
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
+			}
+		}
+
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+				}
+			}
+		}
+
+		if (set_valid) {
+			res->set(name, value);
+		}
+	}
+	p_pending.properties.clear();
+
+	if (p_pending.missing_resource) {
+		p_pending.missing_resource->set_recording_properties(false);
+	}
+
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
+
+#ifdef TOOLS_ENABLED
+	res->set_edited(false);
+#endif
+}
+
+void ResourceLoaderBinary::_find_pending_dependency_level(const Variant &p_value, uint32_t &r_level) const {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT: {
+			const uint32_t *index = pending_indices.getptr(Object::cast_to<Resource>(p_value.get_validated_object()));
+			if (index) {
+				r_level = MAX(r_level, pending_resources[*index].level + 1);
+			}
+		} break;
+		case Variant::ARRAY: {
+			Array array = p_value;
+			for (int i = 0; i < array.size(); i++) {
+				_find_pending_dependency_level(array[i], r_level);
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary dict = p_value;
+			List<Variant> keys;
+			dict.get_key_list(&keys);
+			for (const Variant &E : keys) {
+				_find_pending_dependency_level(E, r_level);
+				_find_pending_dependency_level(dict[E], r_level);
+			}
+		} break;
+		default: {
+		}
+	}
+}
+
+void ResourceLoaderBinary::_set_pending_properties(PendingBatch *p_batch) {
+	while (true) {
+		uint32_t i = p_batch->next.postincrement();
+		if (i >= p_batch->indices.size()) {
+			break;
+		}
+		p_batch->loader->_set_properties(p_batch->loader->pending_resources[p_batch->indices[i]]);
+	}
+}
+
+void ResourceLoaderBinary::_set_pending_properties_task(void *p_userdata) {
+	PendingBatch *batch = (PendingBatch *)p_userdata;
+	if (Thread::is_main_thread() || ResourceLoader::is_within_load()) {
+		// Picked up by a thread that is already loading (or the main one), which handles signals properly on its own.
+		_set_pending_properties(batch);
+		return;
+	}
+
+	// Setters connect to the signals of shared sub-resources, which is not thread-safe. Act as a loading thread,
+	// so that work is deferred to the main thread instead (see Resource::connect_changed()).
+	// The pool thread may be running this in the middle of another task, so its state is restored afterwards.
+	CallQueue *prev_mq_override = MessageQueue::get_thread_singleton_override();
+	bool prev_thread_safe_for_nodes = is_current_thread_safe_for_nodes();
+
+	CallQueue *mq_override = memnew(CallQueue);
+	MessageQueue::set_thread_singleton_override(mq_override);
+	set_current_thread_safe_for_nodes(true);
+	ResourceLoader::enter_load_helper();
+
+	_set_pending_properties(batch);
+
+	ResourceLoader::exit_load_helper();
+	mq_override->flush();
+	memdelete(mq_override); // Also unsets the override.
+	if (prev_mq_override) {
+		MessageQueue::set_thread_singleton_override(prev_mq_override);
+	}
+	set_current_thread_safe_for_nodes(prev_thread_safe_for_nodes);
+}
+
+void ResourceLoaderBinary::_apply_pending_resources() {
+	uint32_t max_level = 0;
+	for (const PendingResource &E : pending_resources) {
+		max_level = MAX(max_level, E.level);
+	}
+
+	for (uint32_t level = 0; level <= max_level && !pending_resources.is_empty(); level++) {
+		PendingBatch batch;
+		batch.loader = this;
+		for (uint32_t i = 0; i < pending_resources.size(); i++) {
+			if (pending_resources[i].level == level) {
+				batch.indices.push_back(i);
+			}
+		}
+
+		// The loading thread works on the batch too, helpers just pick up whatever is left.
+		int helper_count = MIN((int)batch.indices.size() - 1, WorkerThreadPool::get_singleton()->get_thread_count());
+		LocalVector<WorkerThreadPool::TaskID> helpers;
+		for (int i = 0; i < helper_count; i++) {
+			helpers.push_back(WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoaderBinary::_set_pending_properties_task, &batch, false, "Set sub-resource properties"));
+		}
+		_set_pending_properties(&batch);
+		for (WorkerThreadPool::TaskID task_id : helpers) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+		}
+	}
+
+	pending_resources.clear();
+	pending_indices.clear();
+}
+
 Error ResourceLoaderBinary::load() {
 	if (error != OK) {
 		return error;
@@ -803,72 +955,50 @@ Error ResourceLoaderBinary::load() {
 
 		int pc = f->get_32();
 
-		//set properties
-
-		Dictionary missing_resource_properties;
+		PendingResource pending;
+		pending.resource = res;
+		pending.missing_resource = missing_resource;
+		pending.properties.resize(pc);
 
 		for (int j = 0; j < pc; j++) {
 			StringName name = _get_string();
 
 			if (name == StringName()) {
 				error = ERR_FILE_CORRUPT;
+				pending_resources.clear();
 				ERR_FAIL_V(ERR_FILE_CORRUPT);
 			}
 
-			Variant value;
-
-			error = parse_variant(value);
+			pending.properties[j].first = name;
+			error = parse_variant(pending.properties[j].second);
 			if (error) {
+				pending_resources.clear();
 				return error;
 			}
-
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
-
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
-
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
-
-			if (set_valid) {
-				res->set(name, value);
-			}
 		}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+		if (progress) {
+			*progress = (i + 1) / float(internal_resources.size());
 		}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
-		}
+		resource_cache.push_back(res);
 
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
+		if (use_sub_threads && !main) {
+			// Sub-resources only reference the ones before them, so they can be set in parallel once those are done.
+			pending.level = 0;
+			for (const Pair<StringName, Variant> &E : pending.properties) {
+				_find_pending_dependency_level(E.second, pending.level);
+			}
+			pending_indices[res.ptr()] = pending_resources.size();
+			pending_resources.push_back(pending);
+			continue;
+		}
 
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+		if (main) {
+			_apply_pending_resources();
 		}
 
-		resource_cache.push_back(res);
+		_set_properties(pending);
 
 		if (main) {
 			f.unref();
@@ -34,6 +34,11 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -78,6 +83,28 @@ class ResourceLoaderBinary {
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
+	// Sub-resources whose properties are set on worker threads when loading with sub-threads.
+	struct PendingResource {
+		Ref<Resource> resource;
+		MissingResource *missing_resource = nullptr;
+		LocalVector<Pair<StringName, Variant>> properties;
+		uint32_t level = 0; // Sub-resources of one level don't depend on each other.
+	};
+	LocalVector<PendingResource> pending_resources;
+	HashMap<Resource *, uint32_t> pending_indices;
+
+	struct PendingBatch {
+		ResourceLoaderBinary *loader = nullptr;
+		LocalVector<uint32_t> indices;
+		SafeNumeric<uint32_t> next;
+	};
+
+	void _set_properties(PendingResource &p_pending);
+	void _find_pending_dependency_level(const Variant &p_value, uint32_t &r_level) const;
+	void _apply_pending_resources();
+	static void _set_pending_properties(PendingBatch *p_batch);
+	static void _set_pending_properties_task(void *p_userdata);
+
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
 
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_pack.h"
 #include "core/io/resource_importer.h"
 #include "core/object/script_language.h"
 #include "core/os/condition_variable.h"
@@ -323,6 +324,12 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 		set_current_thread_safe_for_nodes(true);
 	}
 
+	// Held until this load finishes, so the prefetched dependencies are found in flight (or done) by the loader.
+	Vector<Ref<LoadToken>> prefetch_tokens;
+	if (load_task.prefetch_dependencies) {
+		_prefetch_dependencies(load_task.local_path, load_task.use_sub_threads, prefetch_tokens);
+	}
+
 	Ref<Resource> res = _load(load_task.remapped_path, load_task.remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, load_task.cache_mode, &load_task.error, load_task.use_sub_threads, &load_task.progress);
 	if (mq_override) {
 		mq_override->flush();
@@ -345,6 +352,7 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 		load_task.cond_var = nullptr;
 	}
 
+	Ref<Resource> to_retain;
 	bool ignoring = load_task.cache_mode == ResourceFormatLoader::CACHE_MODE_IGNORE || load_task.cache_mode == ResourceFormatLoader::CACHE_MODE_IGNORE_DEEP;
 	bool replacing = load_task.cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE || load_task.cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE_DEEP;
 	if (load_task.resource.is_valid()) {
@@ -358,6 +366,7 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 				}
 			}
 			load_task.resource->set_path(load_task.local_path, replacing);
+			to_retain = load_task.resource;
 		} else {
 			load_task.resource->set_path_cache(load_task.local_path);
 		}
@@ -393,6 +402,13 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 
 	thread_load_mutex.unlock();
 
+	if (to_retain.is_valid()) {
+		ResourceCache::retain(to_retain);
+	}
+
+	// Must happen outside of the lock, since releasing an unused token awaits its task.
+	prefetch_tokens.clear();
+
 	if (load_nesting == 0) {
 		if (mq_override) {
 			memdelete(mq_override);
@@ -491,10 +507,13 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			load_task.type_hint = p_type_hint;
 			load_task.cache_mode = p_cache_mode;
 			load_task.use_sub_threads = p_thread_mode == LOAD_THREAD_DISTRIBUTE;
+			// Only for requests not issued from within another load; nested ones are covered by the outermost request.
+			load_task.prefetch_dependencies = load_task.use_sub_threads && p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && load_nesting == 0;
 			if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
 				Ref<Resource> existing = ResourceCache::get_ref(local_path);
 				if (existing.is_valid()) {
 					//referencing is fine
+					ResourceCache::retain(existing);
 					load_task.resource = existing;
 					load_task.status = THREAD_LOAD_LOADED;
 					load_task.progress = 1.0;
@@ -534,6 +553,108 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 	return load_token;
 }
 
+bool ResourceLoader::_collect_dependencies(const String &p_local_path, HashMap<String, bool> &r_visited, Vector<Pair<String, String>> &r_order) {
+	r_visited[p_local_path] = false; // Being visited.
+
+	List<String> deps;
+	get_dependencies(p_local_path, &deps, true);
+	for (const String &dep : deps) {
+		String path = dep.get_slice("::", 0);
+		String type = dep.get_slice_count("::") >= 2 ? dep.get_slice("::", 1) : String();
+
+		ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(path);
+		if (uid != ResourceUID::INVALID_ID) {
+			if (ResourceUID::get_singleton()->has_id(uid)) {
+				path = ResourceUID::get_singleton()->get_id_path(uid);
+			} else if (dep.get_slice_count("::") >= 3) {
+				path = dep.get_slice("::", 2);
+			} else {
+				continue; // Let the loader report it.
+			}
+		}
+		path = _validate_local_path(path);
+
+		HashMap<String, bool>::Iterator E = r_visited.find(path);
+		if (E) {
+			if (!E->value) {
+				return false; // Cyclic; prefetching could make both ends await each other.
+			}
+			continue;
+		}
+		if (ResourceCache::has(path) || !exists(path, type)) {
+			r_visited[path] = true;
+			continue;
+		}
+
+		if (!_collect_dependencies(path, r_visited, r_order)) {
+			return false;
+		}
+		r_order.push_back(Pair<String, String>(path, type));
+	}
+
+	r_visited[p_local_path] = true;
+	return true;
+}
+
+void ResourceLoader::_prefetch_dependencies(const String &p_local_path, bool p_use_sub_threads, Vector<Ref<LoadToken>> &r_tokens) {
+	HashMap<String, bool> visited;
+	Vector<Pair<String, String>> order; // Dependencies first.
+	if (!_collect_dependencies(p_local_path, visited, order) || order.is_empty()) {
+		return;
+	}
+
+	// Issue reads for files in packs in the order they are stored, so the device streams rather than seeks.
+	// Files outside packs (or whose location is unknown) keep the dependencies-first order, after those.
+	struct PrefetchEntry {
+		int index = 0;
+		String pack;
+		uint64_t offset = 0;
+		bool packed = false;
+
+		bool operator<(const PrefetchEntry &p_other) const {
+			if (packed != p_other.packed) {
+				return packed;
+			}
+			if (packed && pack != p_other.pack) {
+				return pack < p_other.pack;
+			}
+			if (packed && offset != p_other.offset) {
+				return offset < p_other.offset;
+			}
+			return index < p_other.index;
+		}
+	};
+
+	PackedData *packed_data = PackedData::get_singleton();
+	bool use_packs = packed_data && !packed_data->is_disabled();
+
+	Vector<PrefetchEntry> entries;
+	entries.resize(order.size());
+	for (int i = 0; i < order.size(); i++) {
+		PrefetchEntry &entry = entries.write[i];
+		entry.index = i;
+		if (use_packs) {
+			String file_path = _path_remap(order[i].first);
+			if (ResourceFormatImporter::get_singleton() && ResourceFormatImporter::get_singleton()->recognize_path(file_path)) {
+				file_path = ResourceFormatImporter::get_singleton()->get_internal_resource_path(file_path);
+			}
+			entry.packed = packed_data->get_path_offset(file_path, &entry.pack, &entry.offset);
+		}
+	}
+	entries.sort();
+
+	// Started as nested loads, so they don't prefetch again; their own dependencies are already part of the closure.
+	// They keep the sub-threads of the request, so each one can set its sub-resources in parallel too.
+	LoadThreadMode thread_mode = p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE;
+	load_nesting++;
+	r_tokens.resize(entries.size());
+	for (int i = 0; i < entries.size(); i++) {
+		const Pair<String, String> &dep = order[entries[i].index];
+		r_tokens.write[i] = _load_start(dep.first, dep.second, thread_mode, ResourceFormatLoader::CACHE_MODE_REUSE);
+	}
+	load_nesting--;
+}
+
 float ResourceLoader::_dependency_get_progress(const String &p_path) {
 	if (thread_load_tasks.has(p_path)) {
 		ThreadLoadTask &load_task = thread_load_tasks[p_path];
@@ -36,6 +36,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
+#include "core/templates/pair.h"
 
 class ConditionVariable;
 
@@ -180,10 +181,13 @@ private:
 		Ref<Resource> resource;
 		bool xl_remapped = false;
 		bool use_sub_threads = false;
+		bool prefetch_dependencies = false; // Start the whole dependency closure up-front (top-level sub-threaded requests only).
 		HashSet<String> sub_tasks;
 	};
 
 	static void _thread_load_function(void *p_userdata);
+	static bool _collect_dependencies(const String &p_local_path, HashMap<String, bool> &r_visited, Vector<Pair<String, String>> &r_order);
+	static void _prefetch_dependencies(const String &p_local_path, bool p_use_sub_threads, Vector<Ref<LoadToken>> &r_tokens);
 
 	static thread_local int load_nesting;
 	static thread_local WorkerThreadPool::TaskID caller_task_id;
@@ -202,6 +206,9 @@ public:
 	static Ref<Resource> load_threaded_get(const String &p_path, Error *r_error = nullptr);
 
 	static bool is_within_load() { return load_nesting > 0; };
+	// For tasks doing part of a load on behalf of a loading thread, so they defer main-thread-only work like it does.
+	static void enter_load_helper() { load_nesting++; }
+	static void exit_load_helper() { load_nesting--; }
 
 	static Ref<Resource> load(const String &p_path, const String &p_type_hint = "", ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE, Error *r_error = nullptr);
 	static bool exists(const String &p_path, const String &p_type_hint = "");
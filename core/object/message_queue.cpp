@@ -34,6 +34,7 @@
 #include "core/core_string_names.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
 
 #include <stdio.h>
 
@@ -59,6 +60,117 @@
 		mutex.unlock();                           \
 	}
 
+// Lanes recently used by the current thread, keyed by queue ID rather than pointer,
+// so entries left behind by deleted queues are never matched again. The ticket tells
+// whether the lane still belongs to this thread or was reclaimed by a flush meanwhile.
+struct ThreadLaneCacheEntry {
+	uint64_t queue_id = 0;
+	uint64_t ticket = 0;
+	CallQueue *lane = nullptr;
+};
+
+static constexpr uint32_t THREAD_LANE_CACHE_SIZE = 4;
+static thread_local ThreadLaneCacheEntry thread_lane_cache[THREAD_LANE_CACHE_SIZE];
+static thread_local uint32_t thread_lane_cache_next = 0;
+static SafeNumeric<uint64_t> last_queue_id;
+static SafeNumeric<uint64_t> last_lane_ticket;
+
+bool CallQueue::_should_use_thread_lane() const {
+	return !is_thread_lane && !Thread::is_main_thread() && this != MessageQueue::thread_singleton;
+}
+
+// Returns the lane of the current thread, with its mutex locked.
+CallQueue *CallQueue::_lock_thread_lane() {
+	ThreadLaneCacheEntry *entry = nullptr;
+	for (ThreadLaneCacheEntry &E : thread_lane_cache) {
+		if (E.queue_id == queue_id) {
+			E.lane->mutex.lock();
+			if (E.lane->lane_ticket == E.ticket) {
+				return E.lane;
+			}
+			// Reclaimed by a flush, get a new one.
+			E.lane->mutex.unlock();
+			entry = &E;
+			break;
+		}
+	}
+
+	if (!entry) {
+		entry = &thread_lane_cache[thread_lane_cache_next];
+		thread_lane_cache_next = (thread_lane_cache_next + 1) % THREAD_LANE_CACHE_SIZE;
+	}
+
+	CallQueue *lane = nullptr;
+	{
+		MutexLock lock(mutex);
+		if (free_thread_lanes.is_empty()) {
+			lane = memnew(CallQueue(allocator, max_pages, error_text));
+			lane->is_thread_lane = true;
+		} else {
+			lane = free_thread_lanes[free_thread_lanes.size() - 1];
+			free_thread_lanes.resize(free_thread_lanes.size() - 1);
+		}
+		thread_lanes.push_back(lane);
+
+		lane->mutex.lock();
+		lane->lane_ticket = last_lane_ticket.increment();
+	}
+
+	entry->queue_id = queue_id;
+	entry->ticket = lane->lane_ticket;
+	entry->lane = lane;
+
+	return lane;
+}
+
+// Must be called with the mutex locked. Returns true if any message was moved to this queue.
+bool CallQueue::_merge_thread_lanes() {
+	if (!thread_lanes_pending.is_set()) {
+		return false;
+	}
+	// Cleared before merging, so messages pushed meanwhile are picked up by the next merge.
+	thread_lanes_pending.clear();
+
+	bool merged = false;
+	for (uint32_t i = 0; i < thread_lanes.size();) {
+		CallQueue *lane = thread_lanes[i];
+		lane->mutex.lock();
+		if (lane->has_messages()) {
+			if (lane->_append_messages_to(this) != OK) {
+				// Not enough room yet, keep the lane with its owner and try again on the next flush.
+				thread_lanes_pending.set();
+				lane->mutex.unlock();
+				i++;
+				continue;
+			}
+			merged = true;
+		}
+		// Give the pages back and reclaim the lane, so threads that are done pushing (or exited)
+		// don't keep either. Threads that push again get a lane from the free list.
+		lane->_release_thread_lane();
+		lane->mutex.unlock();
+
+		thread_lanes.remove_at_unordered(i);
+		free_thread_lanes.push_back(lane);
+	}
+	return merged;
+}
+
+void CallQueue::_release_thread_lane() {
+	for (Page *page : pages) {
+		allocator->free(page);
+	}
+	pages.clear();
+	page_bytes.clear();
+	pages_used = 0;
+	lane_ticket = 0;
+}
+
+uint32_t CallQueue::get_thread_lane_count() {
+	MutexLock lock(mutex);
+	return thread_lanes.size() + free_thread_lanes.size();
+}
+
 void CallQueue::_add_page() {
 	if (pages_used == page_bytes.size()) {
 		pages.push_back(allocator->alloc());
@@ -89,6 +201,14 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
+	if (_should_use_thread_lane()) {
+		CallQueue *lane = _lock_thread_lane();
+		Error err = lane->push_callablep(p_callable, p_args, p_argcount, p_show_error);
+		lane->mutex.unlock();
+		thread_lanes_pending.set();
+		return err;
+	}
+
 	LOCK_MUTEX;
 
 	_ensure_first_page();
@@ -135,6 +255,14 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 }
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
+	if (_should_use_thread_lane()) {
+		CallQueue *lane = _lock_thread_lane();
+		Error err = lane->push_set(p_id, p_prop, p_value);
+		lane->mutex.unlock();
+		thread_lanes_pending.set();
+		return err;
+	}
+
 	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
@@ -176,6 +304,15 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 
 Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
+
+	if (_should_use_thread_lane()) {
+		CallQueue *lane = _lock_thread_lane();
+		Error err = lane->push_notification(p_id, p_notification);
+		lane->mutex.unlock();
+		thread_lanes_pending.set();
+		return err;
+	}
+
 	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message);
 
@@ -224,51 +361,44 @@ void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args
 	}
 }
 
-Error CallQueue::_transfer_messages_to_main_queue() {
+// Moves all messages of this queue to the end of the target one, which must be locked by the caller.
+Error CallQueue::_append_messages_to(CallQueue *p_target) {
 	if (pages.size() == 0) {
 		return OK;
 	}
 
-	CallQueue *mq = MessageQueue::main_singleton;
-	DEV_ASSERT(!mq->allocator_is_custom && !allocator_is_custom); // Transferring pages is only safe if using the same alloator parameters.
-
-	mq->mutex.lock();
-
-	// Here we're transferring the data from this queue to the main one.
-	// However, it's very unlikely big amounts of messages will be queued here,
+	// It's very unlikely big amounts of messages will be queued here,
 	// so PagedArray/Pool would be overkill. Also, in most cases the data will fit
-	// an already existing page of the main queue.
+	// an already existing page of the target queue.
 
 	// Let's see if our first (likely only) page fits the current target queue page.
-	uint32_t src_page = 0;
-	{
-		if (mq->pages_used) {
-			uint32_t dst_page = mq->pages_used - 1;
-			uint32_t dst_offset = mq->page_bytes[dst_page];
-			if (dst_offset + page_bytes[0] < uint32_t(PAGE_SIZE_BYTES)) {
-				memcpy(mq->pages[dst_page]->data + dst_offset, pages[0]->data, page_bytes[0]);
-				mq->page_bytes[dst_page] += page_bytes[0];
-				src_page++;
-			}
-		}
+	bool first_page_fits = false;
+	if (p_target->pages_used) {
+		uint32_t dst_offset = p_target->page_bytes[p_target->pages_used - 1];
+		first_page_fits = dst_offset + page_bytes[0] < uint32_t(PAGE_SIZE_BYTES);
 	}
 
 	// Any other possibly existing source page needs to be added.
-
-	if (mq->pages_used + (pages_used - src_page) > mq->max_pages) {
-		fprintf(stderr, "Failed appending thread queue. Message queue out of memory. %s\n", mq->error_text.utf8().get_data());
-		mq->statistics();
-		mq->mutex.unlock();
+	uint32_t pages_needed = pages_used - (first_page_fits ? 1 : 0);
+	if (p_target->pages_used + pages_needed > p_target->max_pages) {
+		fprintf(stderr, "Failed appending thread queue. Message queue out of memory. %s\n", p_target->error_text.utf8().get_data());
+		p_target->statistics();
 		return ERR_OUT_OF_MEMORY;
 	}
 
-	for (; src_page < pages_used; src_page++) {
-		mq->_add_page();
-		memcpy(mq->pages[mq->pages_used - 1]->data, pages[src_page]->data, page_bytes[src_page]);
-		mq->page_bytes[mq->pages_used - 1] = page_bytes[src_page];
+	uint32_t src_page = 0;
+	if (first_page_fits) {
+		uint32_t dst_page = p_target->pages_used - 1;
+		memcpy(p_target->pages[dst_page]->data + p_target->page_bytes[dst_page], pages[0]->data, page_bytes[0]);
+		p_target->page_bytes[dst_page] += page_bytes[0];
+		src_page++;
 	}
 
-	mq->mutex.unlock();
+	for (; src_page < pages_used; src_page++) {
+		p_target->_add_page();
+		memcpy(p_target->pages[p_target->pages_used - 1]->data, pages[src_page]->data, page_bytes[src_page]);
+		p_target->page_bytes[p_target->pages_used - 1] = page_bytes[src_page];
+	}
 
 	page_bytes[0] = 0;
 	pages_used = 1;
@@ -276,6 +406,17 @@ Error CallQueue::_transfer_messages_to_main_queue() {
 	return OK;
 }
 
+Error CallQueue::_transfer_messages_to_main_queue() {
+	CallQueue *mq = MessageQueue::main_singleton;
+	DEV_ASSERT(!mq->allocator_is_custom && !allocator_is_custom); // Transferring pages is only safe if using the same alloator parameters.
+
+	mq->mutex.lock();
+	Error err = _append_messages_to(mq);
+	mq->mutex.unlock();
+
+	return err;
+}
+
 Error CallQueue::flush() {
 	// Thread overrides are not meant to be flushed, but appended to the main one.
 	if (unlikely(this == MessageQueue::thread_singleton)) {
@@ -284,6 +425,8 @@ Error CallQueue::flush() {
 
 	LOCK_MUTEX;
 
+	_merge_thread_lanes();
+
 	if (pages.size() == 0) {
 		// Never allocated
 		UNLOCK_MUTEX;
@@ -300,7 +443,20 @@ Error CallQueue::flush() {
 	uint32_t i = 0;
 	uint32_t offset = 0;
 
-	while (i < pages_used && offset < page_bytes[i]) {
+	while (true) {
+		if (offset == page_bytes[i]) {
+			if (i + 1 < pages_used) {
+				i++;
+				offset = 0;
+				continue;
+			}
+			// Also process what other threads pushed while flushing.
+			if (!_merge_thread_lanes()) {
+				break;
+			}
+			continue;
+		}
+
 		Page *page = pages[i];
 
 		//lock on each iteration, so a call can re-add itself to the message queue
@@ -349,10 +505,6 @@ Error CallQueue::flush() {
 		message->~Message();
 
 		LOCK_MUTEX;
-		if (offset == page_bytes[i]) {
-			i++;
-			offset = 0;
-		}
 	}
 
 	page_bytes[0] = 0;
@@ -366,6 +518,16 @@ Error CallQueue::flush() {
 void CallQueue::clear() {
 	LOCK_MUTEX;
 
+	for (CallQueue *lane : thread_lanes) {
+		lane->mutex.lock();
+		lane->clear();
+		lane->_release_thread_lane();
+		lane->mutex.unlock();
+		free_thread_lanes.push_back(lane);
+	}
+	thread_lanes.clear();
+	thread_lanes_pending.clear();
+
 	if (pages.size() == 0) {
 		UNLOCK_MUTEX;
 		return; // Nothing to clear.
@@ -504,6 +666,9 @@ bool CallQueue::is_flushing() const {
 }
 
 bool CallQueue::has_messages() const {
+	if (thread_lanes_pending.is_set()) {
+		return true;
+	}
 	if (pages_used == 0) {
 		return false;
 	}
@@ -528,10 +693,14 @@ CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const
 	}
 	max_pages = p_max_pages;
 	error_text = p_error_text;
+	queue_id = last_queue_id.increment();
 }
 
 CallQueue::~CallQueue() {
 	clear();
+	for (CallQueue *lane : free_thread_lanes) {
+		memdelete(lane);
+	}
 	// Let go of pages.
 	for (uint32_t i = 0; i < pages.size(); i++) {
 		allocator->free(pages[i]);
@@ -35,6 +35,7 @@
 #include "core/os/thread_safe.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
 class Object;
@@ -77,6 +78,17 @@ private:
 	uint32_t pages_used = 0;
 	bool flushing = false;
 
+	// Messages pushed from threads other than the main one go to a queue (lane) owned by the pushing thread,
+	// so producers don't contend on the mutex of this one. Lanes are appended to this queue when flushing,
+	// which keeps the order of messages coming from the same thread. Merged lanes go back to a free list,
+	// so the number of lanes is bounded by the threads pushing between two flushes.
+	uint64_t queue_id = 0;
+	uint64_t lane_ticket = 0; // Identifies the current owner of a lane, zero while free.
+	bool is_thread_lane = false;
+	LocalVector<CallQueue *> thread_lanes;
+	LocalVector<CallQueue *> free_thread_lanes;
+	SafeFlag thread_lanes_pending;
+
 #ifdef DEV_ENABLED
 	bool is_current_thread_override = false;
 #endif
@@ -98,6 +110,12 @@ private:
 		}
 	}
 
+	_FORCE_INLINE_ bool _should_use_thread_lane() const;
+	CallQueue *_lock_thread_lane();
+	bool _merge_thread_lanes();
+	void _release_thread_lane();
+
+	Error _append_messages_to(CallQueue *p_target);
 	Error _transfer_messages_to_main_queue();
 
 	void _add_page();
@@ -151,6 +169,7 @@ public:
 	void statistics();
 
 	bool has_messages() const;
+	uint32_t get_thread_lane_count();
 
 	bool is_flushing() const;
 	int get_max_buffer_usage() const;
@@ -168,6 +187,7 @@ public:
 	_FORCE_INLINE_ static CallQueue *get_singleton() { return thread_singleton ? thread_singleton : main_singleton; }
 
 	static void set_thread_singleton_override(CallQueue *p_thread_singleton);
+	_FORCE_INLINE_ static CallQueue *get_thread_singleton_override() { return thread_singleton; }
 
 	MessageQueue();
 	~MessageQueue();
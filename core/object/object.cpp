@@ -1168,30 +1168,23 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
 	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	Callable *slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-	uint32_t *slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-	uint32_t slot_count = 0;
-
-	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-		slot_flags[slot_count] = slot_kv.value.conn.flags;
-		++slot_count;
-	}
-
-	DEV_ASSERT(slot_count == s->slot_map.size());
+	// will not affect the signal calling. Changes to the connections
+	// copy the slot list on write, so referencing it is enough.
+	const Vector<SignalData::EmitSlot> slots = s->emit_slots;
+	const SignalData::EmitSlot *slot_ptr = slots.ptr();
+	const int slot_count = slots.size();
 
 	// Disconnect all one-shot connections before emitting to prevent recursion.
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+	for (int i = 0; i < slot_count; ++i) {
+		bool disconnect = slot_ptr[i].flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-		if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+		if (disconnect && (slot_ptr[i].flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
 			// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
 			disconnect = false;
 		}
 #endif
 		if (disconnect) {
-			_disconnect(p_name, slot_callables[i]);
+			_disconnect(p_name, slot_ptr[i].callable);
 		}
 	}
 
@@ -1199,9 +1192,9 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	Error err = OK;
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+	for (int i = 0; i < slot_count; ++i) {
+		const Callable &callable = slot_ptr[i].callable;
+		const uint32_t &flags = slot_ptr[i].flags;
 
 		if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
@@ -1237,13 +1230,23 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
-	}
-
 	return err;
 }
 
+void Object::SignalData::compact_emit_slots() {
+	Vector<EmitSlot> compacted;
+	compacted.resize(slot_map.size());
+	EmitSlot *compacted_ptr = compacted.ptrw();
+	uint32_t index = 0;
+	for (KeyValue<Callable, Slot> &slot_kv : slot_map) {
+		compacted_ptr[index] = emit_slots[slot_kv.value.emit_index];
+		slot_kv.value.emit_index = index;
+		index++;
+	}
+	emit_slots = compacted;
+	emit_slots_removed = 0;
+}
+
 void Object::_add_user_signal(const String &p_name, const Array &p_args) {
 	// this version of add_user_signal is meant to be used from scripts or external apis
 	// without access to ADD_SIGNAL in bind_methods
@@ -1452,6 +1455,12 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 		slot.reference_count = 1;
 	}
 
+	SignalData::EmitSlot emit_slot;
+	emit_slot.callable = p_callable;
+	emit_slot.flags = p_flags;
+	slot.emit_index = s->emit_slots.size();
+	s->emit_slots.push_back(emit_slot);
+
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
 
@@ -1510,11 +1519,17 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 		}
 	}
 
+	// Leave a null callable behind, so indices of other slots remain valid.
+	s->emit_slots.write[slot->emit_index] = SignalData::EmitSlot();
+	s->emit_slots_removed++;
+
 	s->slot_map.erase(*p_callable.get_base_comparator());
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
 		signal_map.erase(p_signal);
+	} else if (s->emit_slots_removed * 2 > (uint32_t)s->emit_slots.size()) {
+		s->compact_emit_slots();
 	}
 
 	return true;
@@ -616,11 +616,23 @@ private:
 			int reference_count = 0;
 			Connection conn;
 			List<Connection>::Element *cE = nullptr;
+			uint32_t emit_index = 0;
+		};
+
+		struct EmitSlot {
+			Callable callable;
+			uint32_t flags = 0;
 		};
 
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		// Same connections in connection order, shared with emissions in progress so they don't have to copy them.
+		// Disconnected slots are left as null callables and compacted once they make up half of the list.
+		Vector<EmitSlot> emit_slots;
+		uint32_t emit_slots_removed = 0;
 		bool removable = false;
+
+		void compact_emit_slots();
 	};
 
 	HashMap<StringName, SignalData> signal_map;
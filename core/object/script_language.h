@@ -415,6 +415,13 @@ public:
 	virtual int profiling_get_accumulated_data(ProfilingInfo *p_info_arr, int p_info_max) = 0;
 	virtual int profiling_get_frame_data(ProfilingInfo *p_info_arr, int p_info_max) = 0;
 
+	// Sampling profiler. Samples are requested periodically from a timer thread,
+	// and gathered as collapsed call stacks ("outer;inner" -> sample count).
+	virtual void profiling_sampling_start() {}
+	virtual void profiling_sampling_stop() {}
+	virtual void profiling_request_sample() {}
+	virtual void profiling_get_sampled_stacks(HashMap<String, uint64_t> &r_stacks) {}
+
 	virtual void frame();
 
 	virtual bool handles_global_class_type(const String &p_type) const { return false; }
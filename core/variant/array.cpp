@@ -47,6 +47,12 @@ public:
 	Vector<Variant> array;
 	Variant *read_only = nullptr; // If enabled, a pointer is used to a temporary value that is used to return read-only values.
 	ContainerTypeValidate typed;
+
+	// Values of exactly the element type (or any value, if untyped) need no validation nor coercion,
+	// so they can be stored without going through a temporary copy.
+	_FORCE_INLINE_ bool is_exact_element(const Variant &p_value) const {
+		return typed.type == Variant::NIL || (typed.type == p_value.get_type() && typed.type != Variant::OBJECT);
+	}
 };
 
 void Array::_ref(const Array &p_from) const {
@@ -281,6 +287,10 @@ void Array::assign(const Array &p_array) {
 
 void Array::push_back(const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (_p->is_exact_element(p_value)) {
+		_p->array.push_back(p_value);
+		return;
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "push_back"));
 	_p->array.push_back(value);
@@ -289,6 +299,12 @@ void Array::push_back(const Variant &p_value) {
 void Array::append_array(const Array &p_array) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
 
+	if (_p->typed.type == Variant::NIL || _p->typed == p_array._p->typed) {
+		// Elements were already validated when added to the source array.
+		_p->array.append_array(p_array._p->array);
+		return;
+	}
+
 	Vector<Variant> validated_array = p_array._p->array;
 	for (int i = 0; i < validated_array.size(); ++i) {
 		ERR_FAIL_COND(!_p->typed.validate(validated_array.write[i], "append_array"));
@@ -312,6 +328,9 @@ Error Array::resize(int p_new_size) {
 
 Error Array::insert(int p_pos, const Variant &p_value) {
 	ERR_FAIL_COND_V_MSG(_p->read_only, ERR_LOCKED, "Array is in read-only state.");
+	if (_p->is_exact_element(p_value)) {
+		return _p->array.insert(p_pos, p_value);
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND_V(!_p->typed.validate(value, "insert"), ERR_INVALID_PARAMETER);
 	return _p->array.insert(p_pos, value);
@@ -319,6 +338,10 @@ Error Array::insert(int p_pos, const Variant &p_value) {
 
 void Array::fill(const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (_p->is_exact_element(p_value)) {
+		_p->array.fill(p_value);
+		return;
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "fill"));
 	_p->array.fill(value);
@@ -425,6 +448,10 @@ void Array::remove_at(int p_pos) {
 
 void Array::set(int p_idx, const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (_p->is_exact_element(p_value)) {
+		_p->array.write[p_idx] = p_value;
+		return;
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "set"));
 
@@ -673,6 +700,10 @@ void Array::reverse() {
 
 void Array::push_front(const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (_p->is_exact_element(p_value)) {
+		_p->array.insert(0, p_value);
+		return;
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "push_front"));
 	_p->array.insert(0, value);
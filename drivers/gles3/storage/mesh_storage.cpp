@@ -36,6 +36,8 @@
 #include "texture_storage.h"
 #include "utilities.h"
 
+#include "servers/rendering/cpu_skinning.h"
+
 using namespace GLES3;
 
 MeshStorage *MeshStorage::singleton = nullptr;
@@ -635,79 +637,7 @@ AABB MeshStorage::mesh_get_aabb(RID p_mesh, RID p_skeleton) {
 
 			int sbs = skeleton->size;
 			ERR_CONTINUE(bs > sbs);
-			const float *baseptr = skeleton->data.ptr();
-
-			bool found_bone_aabb = false;
-
-			if (skeleton->use_2d) {
-				for (int j = 0; j < bs; j++) {
-					if (skbones[j].size == Vector3(-1, -1, -1)) {
-						continue; //bone is unused
-					}
-
-					const float *dataptr = baseptr + j * 8;
-
-					Transform3D mtx;
-
-					mtx.basis.rows[0][0] = dataptr[0];
-					mtx.basis.rows[0][1] = dataptr[1];
-					mtx.origin.x = dataptr[3];
-
-					mtx.basis.rows[1][0] = dataptr[4];
-					mtx.basis.rows[1][1] = dataptr[5];
-					mtx.origin.y = dataptr[7];
-
-					// Transform bounds to skeleton's space before applying animation data.
-					AABB baabb = surface.mesh_to_skeleton_xform.xform(skbones[j]);
-					baabb = mtx.xform(baabb);
-
-					if (!found_bone_aabb) {
-						laabb = baabb;
-						found_bone_aabb = true;
-					} else {
-						laabb.merge_with(baabb);
-					}
-				}
-			} else {
-				for (int j = 0; j < bs; j++) {
-					if (skbones[j].size == Vector3(-1, -1, -1)) {
-						continue; //bone is unused
-					}
-
-					const float *dataptr = baseptr + j * 12;
-
-					Transform3D mtx;
-
-					mtx.basis.rows[0][0] = dataptr[0];
-					mtx.basis.rows[0][1] = dataptr[1];
-					mtx.basis.rows[0][2] = dataptr[2];
-					mtx.origin.x = dataptr[3];
-					mtx.basis.rows[1][0] = dataptr[4];
-					mtx.basis.rows[1][1] = dataptr[5];
-					mtx.basis.rows[1][2] = dataptr[6];
-					mtx.origin.y = dataptr[7];
-					mtx.basis.rows[2][0] = dataptr[8];
-					mtx.basis.rows[2][1] = dataptr[9];
-					mtx.basis.rows[2][2] = dataptr[10];
-					mtx.origin.z = dataptr[11];
-
-					// Transform bounds to skeleton's space before applying animation data.
-					AABB baabb = surface.mesh_to_skeleton_xform.xform(skbones[j]);
-					baabb = mtx.xform(baabb);
-
-					if (!found_bone_aabb) {
-						laabb = baabb;
-						found_bone_aabb = true;
-					} else {
-						laabb.merge_with(baabb);
-					}
-				}
-			}
-
-			if (found_bone_aabb) {
-				// Transform skeleton bounds back to mesh's space if any animated AABB applied.
-				laabb = surface.mesh_to_skeleton_xform.affine_inverse().xform(laabb);
-			}
+			CPUSkinning::skin_aabb(skbones, bs, skeleton->data.ptr(), skeleton->use_2d, surface.mesh_to_skeleton_xform, laabb);
 
 			if (laabb.size == Vector3()) {
 				laabb = surface.aabb;
@@ -43,6 +43,7 @@
 #include "editor/editor_file_system.h"
 #include "editor/editor_log.h"
 #include "editor/editor_node.h"
+#include "editor/editor_paths.h"
 #include "editor/editor_property_name_processor.h"
 #include "editor/editor_settings.h"
 #include "editor/editor_string_names.h"
@@ -795,6 +796,23 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, uint64_t p_thread
 		} else {
 			profiler->add_frame_metric(metric, true);
 		}
+	} else if (p_msg == "sampling:profile_total") {
+		ServersDebugger::ScriptSampledStacks sampled;
+		ERR_FAIL_COND(!sampled.deserialize(p_data));
+		if (sampled.stacks.is_empty()) {
+			return;
+		}
+
+		const String path = EditorPaths::get_singleton()->get_project_settings_dir().path_join("sampled_call_stacks.folded");
+		Error err;
+		Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE, &err);
+		ERR_FAIL_COND_MSG(err != OK, "Failed to open " + path);
+
+		// Collapsed stacks, one "outer;inner count" line each, as read by flame graph tools.
+		for (const KeyValue<String, uint64_t> &E : sampled.stacks) {
+			file->store_line(E.key + " " + itos(E.value));
+		}
+		EditorNode::get_log()->add_message(vformat(TTR("Sampled script call stacks saved to: %s"), ProjectSettings::get_singleton()->globalize_path(path)), EditorLog::MSG_TYPE_EDITOR);
 	} else if (p_msg == "request_quit") {
 		emit_signal(SNAME("stop_requested"));
 		_stop_and_notify();
@@ -1106,6 +1124,21 @@ void ScriptEditorDebugger::_profiler_activate(bool p_enable, int p_type) {
 				msg_data.push_back(opts);
 			}
 			_put_msg("profiler:servers", msg_data);
+
+			if (p_enable) {
+				int sampling_interval = EDITOR_GET("debugger/profiler_sampling_interval_usec");
+				if (sampling_interval > 0) {
+					Array sampling_data;
+					sampling_data.push_back(true);
+					Array opts;
+					opts.push_back(sampling_interval);
+					sampling_data.push_back(opts);
+					_put_msg("profiler:sampling", sampling_data);
+				}
+			} else {
+				// Stopping an inactive profiler is a no-op, so don't depend on the setting still being the same.
+				_put_msg("profiler:sampling", msg_data);
+			}
 			break;
 		default:
 			ERR_FAIL_MSG("Invalid profiler type");
@@ -4202,6 +4202,7 @@ void Main::cleanup(bool p_force) {
 
 	ResourceLoader::clear_translation_remaps();
 	ResourceLoader::clear_path_remaps();
+	ResourceCache::clear_retained();
 
 	ScriptServer::finish_languages();
 
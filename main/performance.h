@@ -100,6 +100,8 @@ public:
 		NAVIGATION_EDGE_MERGE_COUNT,
 		NAVIGATION_EDGE_CONNECTION_COUNT,
 		NAVIGATION_EDGE_FREE_COUNT,
+		RESOURCE_CACHE_RETAINED_COUNT,
+		RESOURCE_CACHE_RETAINED_MEMORY,
 		MONITOR_MAX
 	};
 
@@ -2291,6 +2291,70 @@ void GDScriptLanguage::profiling_stop() {
 #endif
 }
 
+void GDScriptLanguage::profiling_sampling_start() {
+#ifdef DEBUG_ENABLED
+	MutexLock lock(mutex);
+
+	sampled_stacks.clear();
+	profiling_sampling.set();
+#endif
+}
+
+void GDScriptLanguage::profiling_sampling_stop() {
+#ifdef DEBUG_ENABLED
+	MutexLock lock(mutex);
+
+	profiling_sampling.clear();
+#endif
+}
+
+void GDScriptLanguage::profiling_request_sample() {
+	// Called from the sampling thread, the sample itself is taken by each script thread on its next line.
+	sampling_epoch.increment();
+}
+
+void GDScriptLanguage::profiling_get_sampled_stacks(HashMap<String, uint64_t> &r_stacks) {
+#ifdef DEBUG_ENABLED
+	MutexLock lock(mutex);
+
+	for (const KeyValue<String, uint64_t> &E : sampled_stacks) {
+		HashMap<String, uint64_t>::Iterator F = r_stacks.find(E.key);
+		if (F) {
+			F->value += E.value;
+		} else {
+			r_stacks.insert(E.key, E.value);
+		}
+	}
+	sampled_stacks.clear();
+#endif
+}
+
+void GDScriptLanguage::_take_sample(uint32_t p_elapsed) {
+#ifdef DEBUG_ENABLED
+	if (!profiling_sampling.is_set()) {
+		return;
+	}
+
+	// Collapsed stack format, outermost frame first, as consumed by flame graph tools.
+	String stack;
+	for (int i = 0; i < _call_stack.stack_pos; i++) {
+		if (i > 0) {
+			stack += ";";
+		}
+		stack += _call_stack.levels[i].function->profile.signature;
+	}
+
+	MutexLock lock(mutex);
+
+	HashMap<String, uint64_t>::Iterator E = sampled_stacks.find(stack);
+	if (E) {
+		E->value += p_elapsed;
+	} else {
+		sampled_stacks.insert(stack, p_elapsed);
+	}
+#endif
+}
+
 int GDScriptLanguage::profiling_get_accumulated_data(ProfilingInfo *p_info_arr, int p_info_max) {
 	int current = 0;
 #ifdef DEBUG_ENABLED
@@ -432,6 +432,7 @@ class GDScriptLanguage : public ScriptLanguage {
 	struct CallStack {
 		CallLevel *levels = nullptr;
 		int stack_pos = 0;
+		uint32_t sample_epoch = 0;
 
 		void free() {
 			if (levels) {
@@ -447,6 +448,8 @@ class GDScriptLanguage : public ScriptLanguage {
 	static thread_local CallStack _call_stack;
 	int _debug_max_call_stack = 0;
 
+	friend class TestGDScriptLanguageSamplingAccessor;
+
 	void _add_global(const StringName &p_name, const Variant &p_value);
 
 	friend class GDScriptInstance;
@@ -463,6 +466,12 @@ class GDScriptLanguage : public ScriptLanguage {
 	bool profile_native_calls;
 	uint64_t script_frame_time;
 
+	SafeFlag profiling_sampling;
+	SafeNumeric<uint32_t> sampling_epoch;
+	HashMap<String, uint64_t> sampled_stacks;
+
+	void _take_sample(uint32_t p_elapsed);
+
 	HashMap<String, ObjectID> orphan_subclasses;
 
 public:
@@ -487,6 +496,11 @@ public:
 			return;
 		}
 
+		if (_call_stack.stack_pos == 0) {
+			// Discard sample requests made while no script was running on this thread.
+			_call_stack.sample_epoch = sampling_epoch.get();
+		}
+
 		_call_stack.levels[_call_stack.stack_pos].stack = p_stack;
 		_call_stack.levels[_call_stack.stack_pos].instance = p_instance;
 		_call_stack.levels[_call_stack.stack_pos].function = p_function;
@@ -509,6 +523,15 @@ public:
 		_call_stack.stack_pos--;
 	}
 
+	_FORCE_INLINE_ void poll_sample() {
+		uint32_t epoch = sampling_epoch.get();
+		if (unlikely(_call_stack.sample_epoch != epoch)) {
+			uint32_t elapsed = epoch - _call_stack.sample_epoch;
+			_call_stack.sample_epoch = epoch;
+			_take_sample(elapsed);
+		}
+	}
+
 	virtual Vector<StackInfo> debug_get_current_stack_info() override {
 		Vector<StackInfo> csi;
 		csi.resize(_call_stack.stack_pos);
@@ -614,6 +637,11 @@ public:
 	virtual int profiling_get_accumulated_data(ProfilingInfo *p_info_arr, int p_info_max) override;
 	virtual int profiling_get_frame_data(ProfilingInfo *p_info_arr, int p_info_max) override;
 
+	virtual void profiling_sampling_start() override;
+	virtual void profiling_sampling_stop() override;
+	virtual void profiling_request_sample() override;
+	virtual void profiling_get_sampled_stacks(HashMap<String, uint64_t> &r_stacks) override;
+
 	/* LOADER FUNCTIONS */
 
 	virtual void get_recognized_extensions(List<String> *p_extensions) const override;
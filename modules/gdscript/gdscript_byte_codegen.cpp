@@ -623,6 +623,31 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 	}
 }
 
+void GDScriptByteCodeGenerator::write_jump_if_not_operator(Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
+	// Appends everything but the jump destination, which the caller appends so it can be patched later.
+	if (HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand) && Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type) == Variant::BOOL) {
+		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		if (op_func) {
+			// Fuse the comparison with the conditional jump, so the result doesn't need a temporary.
+			append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT_OPERATOR_VALIDATED);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(op_func);
+#ifdef DEBUG_ENABLED
+			add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
+#endif
+			return;
+		}
+	}
+
+	// Operand types aren't known, evaluate into a temporary and test it.
+	Address condition = Address(Address::TEMPORARY, add_temporary(GDScriptDataType()));
+	write_binary_operator(condition, p_operator, p_left_operand, p_right_operand);
+	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+	append(condition);
+	pop_temporary();
+}
+
 void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const Address &p_source, const GDScriptDataType &p_type) {
 	switch (p_type.kind) {
 		case GDScriptDataType::BUILTIN: {
@@ -1448,6 +1473,12 @@ void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
 	append(0); // Jump destination, will be patched.
 }
 
+void GDScriptByteCodeGenerator::write_if_operator(Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
+	write_jump_if_not_operator(p_operator, p_left_operand, p_right_operand);
+	if_jmp_addrs.push_back(opcodes.size());
+	append(0); // Jump destination, will be patched.
+}
+
 void GDScriptByteCodeGenerator::write_else() {
 	append_opcode(GDScriptFunction::OPCODE_JUMP); // Jump from true if block;
 	int else_jmp_addr = opcodes.size();
@@ -1659,6 +1690,13 @@ void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	append(0); // End of loop address, will be patched.
 }
 
+void GDScriptByteCodeGenerator::write_while_operator(Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
+	// Condition check.
+	write_jump_if_not_operator(p_operator, p_left_operand, p_right_operand);
+	while_jmp_addrs.push_back(opcodes.size());
+	append(0); // End of loop address, will be patched.
+}
+
 void GDScriptByteCodeGenerator::write_endwhile() {
 	// Jump back to loop check.
 	append_opcode(GDScriptFunction::OPCODE_JUMP);
@@ -451,6 +451,8 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.write[p_address] = opcodes.size();
 	}
 
+	void write_jump_if_not_operator(Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand);
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
@@ -531,6 +533,7 @@ public:
 	virtual void write_construct_dictionary(const Address &p_target, const Vector<Address> &p_arguments) override;
 	virtual void write_await(const Address &p_target, const Address &p_operand) override;
 	virtual void write_if(const Address &p_condition) override;
+	virtual void write_if_operator(Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) override;
 	virtual void write_else() override;
 	virtual void write_endif() override;
 	virtual void write_jump_if_shared(const Address &p_value) override;
@@ -541,6 +544,7 @@ public:
 	virtual void write_endfor() override;
 	virtual void start_while_condition() override;
 	virtual void write_while(const Address &p_condition) override;
+	virtual void write_while_operator(Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) override;
 	virtual void write_endwhile() override;
 	virtual void write_break() override;
 	virtual void write_continue() override;
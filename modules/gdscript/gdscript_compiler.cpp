@@ -250,6 +250,25 @@ static bool _can_use_validate_call(const MethodBind *p_method, const Vector<GDSc
 	return true;
 }
 
+static const GDScriptParser::BinaryOpNode *_get_condition_comparison(const GDScriptParser::ExpressionNode *p_condition) {
+	// Comparisons used directly as a condition can be fused with the conditional jump.
+	if (p_condition->type != GDScriptParser::Node::BINARY_OPERATOR || p_condition->is_constant) {
+		return nullptr;
+	}
+	const GDScriptParser::BinaryOpNode *binary = static_cast<const GDScriptParser::BinaryOpNode *>(p_condition);
+	switch (binary->operation) {
+		case GDScriptParser::BinaryOpNode::OP_COMP_EQUAL:
+		case GDScriptParser::BinaryOpNode::OP_COMP_NOT_EQUAL:
+		case GDScriptParser::BinaryOpNode::OP_COMP_LESS:
+		case GDScriptParser::BinaryOpNode::OP_COMP_LESS_EQUAL:
+		case GDScriptParser::BinaryOpNode::OP_COMP_GREATER:
+		case GDScriptParser::BinaryOpNode::OP_COMP_GREATER_EQUAL:
+			return binary;
+		default:
+			return nullptr;
+	}
+}
+
 GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root, bool p_initializer) {
 	if (p_expression->is_constant && !(p_expression->get_datatype().is_meta_type && p_expression->get_datatype().kind == GDScriptParser::DataType::CLASS)) {
 		return codegen.add_constant(p_expression->reduced_value);
@@ -1979,15 +1998,36 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::IF: {
 				const GDScriptParser::IfNode *if_n = static_cast<const GDScriptParser::IfNode *>(s);
-				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, if_n->condition);
-				if (err) {
-					return err;
-				}
+				const GDScriptParser::BinaryOpNode *comparison = _get_condition_comparison(if_n->condition);
+				if (comparison) {
+					GDScriptCodeGenerator::Address left_operand = _parse_expression(codegen, err, comparison->left_operand);
+					if (err) {
+						return err;
+					}
+					GDScriptCodeGenerator::Address right_operand = _parse_expression(codegen, err, comparison->right_operand);
+					if (err) {
+						return err;
+					}
 
-				gen->write_if(condition);
+					gen->write_if_operator(comparison->variant_op, left_operand, right_operand);
 
-				if (condition.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
-					codegen.generator->pop_temporary();
+					if (right_operand.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						codegen.generator->pop_temporary();
+					}
+					if (left_operand.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						codegen.generator->pop_temporary();
+					}
+				} else {
+					GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, if_n->condition);
+					if (err) {
+						return err;
+					}
+
+					gen->write_if(condition);
+
+					if (condition.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						codegen.generator->pop_temporary();
+					}
 				}
 
 				err = _parse_block(codegen, if_n->true_block);
@@ -2049,15 +2089,36 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 
 				gen->start_while_condition();
 
-				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, while_n->condition);
-				if (err) {
-					return err;
-				}
+				const GDScriptParser::BinaryOpNode *comparison = _get_condition_comparison(while_n->condition);
+				if (comparison) {
+					GDScriptCodeGenerator::Address left_operand = _parse_expression(codegen, err, comparison->left_operand);
+					if (err) {
+						return err;
+					}
+					GDScriptCodeGenerator::Address right_operand = _parse_expression(codegen, err, comparison->right_operand);
+					if (err) {
+						return err;
+					}
 
-				gen->write_while(condition);
+					gen->write_while_operator(comparison->variant_op, left_operand, right_operand);
 
-				if (condition.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
-					codegen.generator->pop_temporary();
+					if (right_operand.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						codegen.generator->pop_temporary();
+					}
+					if (left_operand.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						codegen.generator->pop_temporary();
+					}
+				} else {
+					GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, while_n->condition);
+					if (err) {
+						return err;
+					}
+
+					gen->write_while(condition);
+
+					if (condition.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						codegen.generator->pop_temporary();
+					}
 				}
 
 				// Loop variables must be cleared even when `break`/`continue` is used.
@@ -945,6 +945,18 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr = 3;
 			} break;
+			case OPCODE_JUMP_IF_NOT_OPERATOR_VALIDATED: {
+				text += "jump-if-not validated operator ";
+				text += DADDR(1);
+				text += " ";
+				text += operator_names[_code_ptr[ip + 3]];
+				text += " ";
+				text += DADDR(2);
+				text += " to ";
+				text += itos(_code_ptr[ip + 4]);
+
+				incr = 5;
+			} break;
 			case OPCODE_JUMP_TO_DEF_ARGUMENT: {
 				text += "jump-to-default-argument ";
 
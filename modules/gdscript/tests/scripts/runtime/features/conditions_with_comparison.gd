@@ -0,0 +1,59 @@
+# Comparisons used directly as `if`/`while` conditions are fused with the jump.
+
+func count_below(limit: int) -> int:
+	var i := 0
+	while i < limit:
+		i += 1
+	return i
+
+func test():
+	print(count_below(5))
+	print(count_below(0))
+
+	var f := 0.0
+	while f <= 2.0:
+		f += 0.5
+	print(f)
+
+	var mixed := 0
+	while mixed < 2.5:
+		mixed += 1
+	print(mixed)
+
+	var n := 10
+	var total := 0
+	while n != 0:
+		n -= 1
+		if n % 2 == 0:
+			continue
+		if n > 6:
+			total += 100
+		elif n >= 3:
+			total += 10
+		else:
+			total += 1
+	print(total)
+
+	var s := "abc"
+	if s == "abc":
+		print("string equal")
+	if s != "abd":
+		print("string not equal")
+
+	var v := Vector2(1, 2)
+	if v == Vector2(1, 2):
+		print("vector equal")
+
+	var untyped_a = 3
+	var untyped_b = 4.5
+	if untyped_a < untyped_b:
+		print("untyped less")
+	if untyped_a >= untyped_b:
+		print("untyped greater equal")
+	else:
+		print("untyped not greater equal")
+
+	var untyped_i = 0
+	while untyped_i < 3:
+		untyped_i += 1
+	print(untyped_i)
@@ -0,0 +1,182 @@
+/**************************************************************************/
+/*  test_gdscript_sampling.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GDSCRIPT_SAMPLING_H
+#define TEST_GDSCRIPT_SAMPLING_H
+
+#ifdef DEBUG_ENABLED
+
+#include "../gdscript.h"
+#include "servers/debugger/servers_debugger.h"
+
+#include "tests/test_macros.h"
+
+class TestGDScriptLanguageSamplingAccessor {
+	// The language only allocates its call stack when a debugger is attached, so provide one.
+	static constexpr int MAX_CALL_DEPTH = 4;
+	static inline GDScriptLanguage::CallLevel levels[MAX_CALL_DEPTH];
+	static inline GDScriptLanguage::CallLevel *prev_levels = nullptr;
+
+public:
+	static void begin() {
+		prev_levels = GDScriptLanguage::_call_stack.levels;
+		GDScriptLanguage::_call_stack.levels = levels;
+	}
+
+	static void end() {
+		GDScriptLanguage::_call_stack.stack_pos = 0;
+		GDScriptLanguage::_call_stack.levels = prev_levels;
+	}
+
+	// Mimics `GDScriptLanguage::enter_function()` without requiring a script debugger.
+	static void push_call(GDScriptFunction *p_function) {
+		GDScriptLanguage::CallStack &cs = GDScriptLanguage::_call_stack;
+		ERR_FAIL_COND(cs.stack_pos >= MAX_CALL_DEPTH);
+		if (cs.stack_pos == 0) {
+			cs.sample_epoch = GDScriptLanguage::get_singleton()->sampling_epoch.get();
+		}
+		cs.levels[cs.stack_pos].function = p_function;
+		cs.stack_pos++;
+	}
+
+	static void pop_call() {
+		GDScriptLanguage::_call_stack.stack_pos--;
+	}
+
+	// Signatures are only generated when compiling with a debugger attached.
+	static void set_signature(GDScriptFunction *p_function, const String &p_signature) {
+		p_function->profile.signature = p_signature;
+	}
+
+	static void take_sample(uint32_t p_elapsed) {
+		GDScriptLanguage::get_singleton()->_take_sample(p_elapsed);
+	}
+};
+
+namespace GDScriptTests {
+
+TEST_CASE("[Modules][GDScript] Sampled call stacks") {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+func outer():
+	pass
+
+func inner():
+	pass
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	GDScriptFunction *outer = gdscript->get_member_functions()["outer"];
+	GDScriptFunction *inner = gdscript->get_member_functions()["inner"];
+	TestGDScriptLanguageSamplingAccessor::set_signature(outer, "res://sampling.gd::4::outer");
+	TestGDScriptLanguageSamplingAccessor::set_signature(inner, "res://sampling.gd::7::inner");
+	const String outer_stack = "res://sampling.gd::4::outer";
+	const String inner_stack = "res://sampling.gd::4::outer;res://sampling.gd::7::inner";
+
+	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
+	HashMap<String, uint64_t> stacks;
+	TestGDScriptLanguageSamplingAccessor::begin();
+
+	SUBCASE("Samples are only taken while sampling is enabled") {
+		TestGDScriptLanguageSamplingAccessor::push_call(outer);
+		TestGDScriptLanguageSamplingAccessor::take_sample(1);
+		TestGDScriptLanguageSamplingAccessor::pop_call();
+
+		lang->profiling_get_sampled_stacks(stacks);
+		CHECK(stacks.is_empty());
+	}
+
+	SUBCASE("Samples are accumulated per collapsed stack, outermost frame first") {
+		lang->profiling_sampling_start();
+		TestGDScriptLanguageSamplingAccessor::push_call(outer);
+		TestGDScriptLanguageSamplingAccessor::take_sample(2);
+		TestGDScriptLanguageSamplingAccessor::push_call(inner);
+		TestGDScriptLanguageSamplingAccessor::take_sample(1);
+		TestGDScriptLanguageSamplingAccessor::pop_call();
+		TestGDScriptLanguageSamplingAccessor::take_sample(1);
+		TestGDScriptLanguageSamplingAccessor::pop_call();
+		lang->profiling_sampling_stop();
+
+		lang->profiling_get_sampled_stacks(stacks);
+		CHECK(stacks.size() == 2);
+		CHECK(stacks[outer_stack] == 3);
+		CHECK(stacks[inner_stack] == 1);
+
+		HashMap<String, uint64_t> drained;
+		lang->profiling_get_sampled_stacks(drained);
+		CHECK_MESSAGE(drained.is_empty(), "Getting the sampled stacks should clear them.");
+	}
+
+	SUBCASE("Polling takes one sample weighted by the missed requests") {
+		lang->profiling_sampling_start();
+		TestGDScriptLanguageSamplingAccessor::push_call(outer);
+		lang->poll_sample();
+		lang->profiling_request_sample();
+		lang->profiling_request_sample();
+		lang->poll_sample();
+		lang->poll_sample();
+		TestGDScriptLanguageSamplingAccessor::pop_call();
+		lang->profiling_sampling_stop();
+
+		lang->profiling_get_sampled_stacks(stacks);
+		CHECK(stacks.size() == 1);
+		CHECK(stacks[outer_stack] == 2);
+	}
+
+	SUBCASE("Sampled stacks survive serialization") {
+		stacks[outer_stack] = 3;
+		stacks[inner_stack] = 1;
+
+		ServersDebugger::ScriptSampledStacks sent;
+		sent.stacks = stacks;
+		ServersDebugger::ScriptSampledStacks received;
+		CHECK(received.deserialize(sent.serialize()));
+		CHECK(received.stacks.size() == 2);
+		CHECK(received.stacks[outer_stack] == 3);
+		CHECK(received.stacks[inner_stack] == 1);
+
+		ERR_PRINT_OFF;
+		CHECK_FALSE(received.deserialize(Array()));
+		ERR_PRINT_ON;
+	}
+
+	TestGDScriptLanguageSamplingAccessor::end();
+}
+
+} // namespace GDScriptTests
+
+#endif // DEBUG_ENABLED
+
+#endif // TEST_GDSCRIPT_SAMPLING_H
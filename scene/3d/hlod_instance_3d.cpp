@@ -0,0 +1,449 @@
+/**************************************************************************/
+/*  hlod_instance_3d.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "hlod_instance_3d.h"
+
+#include "core/io/marshalls.h"
+#include "scene/3d/mesh_instance_3d.h"
+#include "scene/resources/3d/skin.h"
+#include "scene/resources/surface_tool.h"
+
+bool HLODInstance3D::_is_baked_proxy(const Node *p_node) const {
+	return p_node && p_node->get_parent() == this && p_node->has_meta(SNAME("_hlod_proxy_"));
+}
+
+bool HLODInstance3D::_bake_material_check(const Ref<Material> &p_material) const {
+	// Merging changes the draw order, which transparent surfaces depend on.
+	BaseMaterial3D *base_mat = Object::cast_to<BaseMaterial3D>(p_material.ptr());
+	if (base_mat && base_mat->get_transparency() != BaseMaterial3D::TRANSPARENCY_DISABLED) {
+		return false;
+	}
+	return true;
+}
+
+bool HLODInstance3D::_bake_surface_check(const MeshInstance3D *p_instance, int p_surface) const {
+	Ref<Mesh> mesh = p_instance->get_mesh();
+	if (mesh->surface_get_primitive_type(p_surface) != Mesh::PRIMITIVE_TRIANGLES || mesh->surface_get_array_index_len(p_surface) == 0) {
+		return false;
+	}
+	if (mesh->surface_get_format(p_surface) & Mesh::ARRAY_FORMAT_BONES) {
+		return false;
+	}
+	return _bake_material_check(p_instance->get_active_material(p_surface));
+}
+
+void HLODInstance3D::_bake_collect(Node *p_node, LocalVector<MeshInstance3D *> &r_instances) {
+	if (_is_baked_proxy(p_node)) {
+		return; // Don't merge our own proxies.
+	}
+
+	MeshInstance3D *mi = Object::cast_to<MeshInstance3D>(p_node);
+	if (mi && mi->is_visible_in_tree()) {
+		Ref<Mesh> mesh = mi->get_mesh();
+		bool valid = true;
+
+		if (mesh.is_null() || mesh->get_surface_count() == 0) {
+			valid = false;
+		}
+
+		if (valid && (mi->get_skin().is_valid() || mesh->get_blend_shape_count() > 0)) {
+			valid = false; // Deforming meshes are not static.
+		}
+
+		if (valid && mi->get_material_overlay().is_valid()) {
+			valid = false; // Proxies can't carry the overlay of each merged instance.
+		}
+
+		// The instance is hidden whenever its proxy is in range, so the proxy must contain all of its surfaces.
+		for (int i = 0; valid && i < mesh->get_surface_count(); i++) {
+			valid = _bake_surface_check(mi, i);
+		}
+
+		if ((mi->get_layer_mask() & bake_mask) == 0) {
+			valid = false;
+		}
+
+		if (valid && !mi->get_visibility_parent().is_empty()) {
+			// Leave visibility dependencies set up by the user alone.
+			valid = _is_baked_proxy(mi->get_node_or_null(mi->get_visibility_parent()));
+		}
+
+		if (valid) {
+			r_instances.push_back(mi);
+		}
+	}
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		Node *child = p_node->get_child(i);
+		if (!child->get_owner()) {
+			continue; // may be a helper
+		}
+
+		_bake_collect(child, r_instances);
+	}
+}
+
+Ref<ArrayMesh> HLODInstance3D::_bake_cluster(const LocalVector<MeshInstance3D *> &p_instances) const {
+	struct SurfaceGroup {
+		Ref<Material> material;
+		Ref<SurfaceTool> surface_tool;
+	};
+
+	// Merge every surface sharing a material into a single surface, in the local space of this node.
+	LocalVector<SurfaceGroup> groups;
+	Transform3D global_to_local = get_global_transform().affine_inverse();
+
+	for (MeshInstance3D *mi : p_instances) {
+		Ref<Mesh> mesh = mi->get_mesh();
+		Transform3D xform = global_to_local * mi->get_global_transform();
+
+		for (int i = 0; i < mesh->get_surface_count(); i++) {
+			Ref<Material> material = mi->get_active_material(i);
+
+			SurfaceGroup *group = nullptr;
+			for (SurfaceGroup &E : groups) {
+				if (E.material == material) {
+					group = &E;
+					break;
+				}
+			}
+			if (!group) {
+				groups.push_back(SurfaceGroup());
+				group = &groups[groups.size() - 1];
+				group->material = material;
+				group->surface_tool.instantiate();
+			}
+
+			group->surface_tool->append_from(mesh, i, xform);
+		}
+	}
+
+	if (groups.is_empty()) {
+		return Ref<ArrayMesh>();
+	}
+
+	Ref<ArrayMesh> proxy_mesh;
+	proxy_mesh.instantiate();
+
+	for (SurfaceGroup &group : groups) {
+		Ref<SurfaceTool> st = group.surface_tool;
+		Array arrays = st->commit_to_arrays();
+
+		if (!Math::is_zero_approx(bake_simplification_distance) && SurfaceTool::simplify_func && SurfaceTool::simplify_scale_func) {
+			PackedVector3Array vertices = arrays[Mesh::ARRAY_VERTEX];
+			PackedInt32Array indices = arrays[Mesh::ARRAY_INDEX];
+			Vector<float> vertices_f32 = vector3_to_float32_array(vertices.ptr(), vertices.size());
+
+			float error_scale = SurfaceTool::simplify_scale_func(vertices_f32.ptr(), vertices.size(), sizeof(float) * 3);
+			float target_error = bake_simplification_distance / error_scale;
+			float error = -1.0f;
+
+			// The proxy is only seen from far away, so the borders between merged meshes are not locked.
+			PackedInt32Array simplified;
+			simplified.resize(indices.size());
+			uint32_t index_count = SurfaceTool::simplify_func(
+					(unsigned int *)simplified.ptrw(),
+					(const unsigned int *)indices.ptr(),
+					indices.size(),
+					vertices_f32.ptr(), vertices.size(), sizeof(float) * 3,
+					0, target_error, 0, &error);
+
+			// A surface collapsing entirely is kept as is, as the instances it comes from are still hidden by the proxy.
+			if (index_count > 0) {
+				simplified.resize(index_count);
+				arrays[Mesh::ARRAY_INDEX] = simplified;
+
+				// Drop the vertices the simplification left unreferenced.
+				st->create_from_triangle_arrays(arrays);
+				st->deindex();
+				st->index();
+			}
+		}
+
+		st->set_material(group.material);
+		st->commit(proxy_mesh);
+	}
+
+	if (proxy_mesh->get_surface_count() == 0) {
+		return Ref<ArrayMesh>();
+	}
+
+	return proxy_mesh;
+}
+
+void HLODInstance3D::_update_proxies() {
+	for (int i = 0; i < get_child_count(); i++) {
+		MeshInstance3D *proxy = Object::cast_to<MeshInstance3D>(get_child(i));
+		if (proxy && _is_baked_proxy(proxy)) {
+			proxy->set_visibility_range_begin(proxy_distance);
+			proxy->set_visibility_range_begin_margin(proxy_distance_margin);
+		}
+	}
+}
+
+void HLODInstance3D::set_bake_mask(uint32_t p_mask) {
+	bake_mask = p_mask;
+	update_configuration_warnings();
+}
+
+uint32_t HLODInstance3D::get_bake_mask() const {
+	return bake_mask;
+}
+
+void HLODInstance3D::set_bake_mask_value(int p_layer_number, bool p_value) {
+	ERR_FAIL_COND_MSG(p_layer_number < 1, "Render layer number must be between 1 and 20 inclusive.");
+	ERR_FAIL_COND_MSG(p_layer_number > 20, "Render layer number must be between 1 and 20 inclusive.");
+	uint32_t mask = get_bake_mask();
+	if (p_value) {
+		mask |= 1 << (p_layer_number - 1);
+	} else {
+		mask &= ~(1 << (p_layer_number - 1));
+	}
+	set_bake_mask(mask);
+}
+
+bool HLODInstance3D::get_bake_mask_value(int p_layer_number) const {
+	ERR_FAIL_COND_V_MSG(p_layer_number < 1, false, "Render layer number must be between 1 and 20 inclusive.");
+	ERR_FAIL_COND_V_MSG(p_layer_number > 20, false, "Render layer number must be between 1 and 20 inclusive.");
+	return bake_mask & (1 << (p_layer_number - 1));
+}
+
+void HLODInstance3D::set_bake_cell_size(float p_size) {
+	bake_cell_size = MAX(p_size, 0.01f);
+}
+
+float HLODInstance3D::get_bake_cell_size() const {
+	return bake_cell_size;
+}
+
+void HLODInstance3D::set_bake_simplification_distance(float p_dist) {
+	bake_simplification_distance = MAX(p_dist, 0.0f);
+}
+
+float HLODInstance3D::get_bake_simplification_distance() const {
+	return bake_simplification_distance;
+}
+
+void HLODInstance3D::set_bake_min_instances(int p_count) {
+	bake_min_instances = MAX(p_count, 1);
+}
+
+int HLODInstance3D::get_bake_min_instances() const {
+	return bake_min_instances;
+}
+
+void HLODInstance3D::set_proxy_distance(float p_dist) {
+	proxy_distance = MAX(p_dist, 0.0f);
+	_update_proxies();
+}
+
+float HLODInstance3D::get_proxy_distance() const {
+	return proxy_distance;
+}
+
+void HLODInstance3D::set_proxy_distance_margin(float p_margin) {
+	proxy_distance_margin = MAX(p_margin, 0.0f);
+	_update_proxies();
+}
+
+float HLODInstance3D::get_proxy_distance_margin() const {
+	return proxy_distance_margin;
+}
+
+void HLODInstance3D::clear_proxies() {
+	// Detach the instances that were swapped by our proxies first, so they don't keep dangling paths.
+	Node *root = get_owner();
+	if (!root) {
+		root = get_parent() ? get_parent() : this;
+	}
+
+	LocalVector<Node *> stack;
+	stack.push_back(root);
+	while (!stack.is_empty()) {
+		Node *node = stack[stack.size() - 1];
+		stack.resize(stack.size() - 1);
+
+		Node3D *node_3d = Object::cast_to<Node3D>(node);
+		if (node_3d && !node_3d->get_visibility_parent().is_empty() && _is_baked_proxy(node_3d->get_node_or_null(node_3d->get_visibility_parent()))) {
+			node_3d->set_visibility_parent(NodePath());
+		}
+
+		for (int i = 0; i < node->get_child_count(); i++) {
+			stack.push_back(node->get_child(i));
+		}
+	}
+
+	for (int i = get_child_count() - 1; i >= 0; i--) {
+		Node *child = get_child(i);
+		if (!_is_baked_proxy(child)) {
+			continue;
+		}
+		remove_child(child);
+		child->queue_free();
+	}
+
+	update_configuration_warnings();
+}
+
+HLODInstance3D::BakeError HLODInstance3D::bake(Node *p_from_node) {
+	ERR_FAIL_NULL_V(p_from_node, BAKE_ERROR_NO_MESHES);
+
+	if (!is_inside_tree()) {
+		return BAKE_ERROR_NOT_IN_TREE;
+	}
+
+	clear_proxies();
+
+	LocalVector<MeshInstance3D *> instances;
+	_bake_collect(p_from_node, instances);
+
+	if (instances.is_empty()) {
+		return BAKE_ERROR_NO_MESHES;
+	}
+
+	// Cluster the instances on a uniform grid, in the local space of this node.
+	// Only instances casting shadows the same way share a proxy, so the proxy can cast them the same way too.
+	const int shadow_setting_count = GeometryInstance3D::SHADOW_CASTING_SETTING_SHADOWS_ONLY + 1;
+	HashMap<Vector3i, LocalVector<MeshInstance3D *>> clusters[shadow_setting_count];
+	Transform3D global_to_local = get_global_transform().affine_inverse();
+
+	for (MeshInstance3D *mi : instances) {
+		Vector3 center = global_to_local.xform(mi->get_global_transform().xform(mi->get_aabb().get_center()));
+		Vector3i cell = Vector3i((center / bake_cell_size).floor());
+		clusters[mi->get_cast_shadows_setting()][cell].push_back(mi);
+	}
+
+	Node *owner = get_owner() ? get_owner() : this;
+	int proxy_count = 0;
+
+	for (int shadow_setting = 0; shadow_setting < shadow_setting_count; shadow_setting++) {
+		for (const KeyValue<Vector3i, LocalVector<MeshInstance3D *>> &E : clusters[shadow_setting]) {
+			if (E.value.size() < (uint32_t)bake_min_instances) {
+				continue;
+			}
+
+			Ref<ArrayMesh> proxy_mesh = _bake_cluster(E.value);
+			if (proxy_mesh.is_null()) {
+				continue;
+			}
+
+			uint32_t layer_mask = 0;
+			for (const MeshInstance3D *mi : E.value) {
+				layer_mask |= mi->get_layer_mask();
+			}
+
+			MeshInstance3D *proxy = memnew(MeshInstance3D);
+			proxy->set_name("Proxy" + itos(proxy_count));
+			proxy->set_meta(SNAME("_hlod_proxy_"), true);
+			proxy->set_mesh(proxy_mesh);
+			proxy->set_layer_mask(layer_mask);
+			proxy->set_cast_shadows_setting(GeometryInstance3D::ShadowCastingSetting(shadow_setting));
+			proxy->set_visibility_range_begin(proxy_distance);
+			proxy->set_visibility_range_begin_margin(proxy_distance_margin);
+			add_child(proxy, true);
+			proxy->set_owner(owner);
+
+			// The merged instances are hidden by the renderer whenever their proxy is in range.
+			for (MeshInstance3D *mi : E.value) {
+				mi->set_visibility_parent(mi->get_path_to(proxy));
+			}
+
+			proxy_count++;
+		}
+	}
+
+	if (proxy_count == 0) {
+		return BAKE_ERROR_NO_MESHES;
+	}
+
+	update_configuration_warnings();
+
+	return BAKE_ERROR_OK;
+}
+
+PackedStringArray HLODInstance3D::get_configuration_warnings() const {
+	PackedStringArray warnings = Node::get_configuration_warnings();
+
+	if (bake_mask == 0) {
+		warnings.push_back(RTR("The Bake Mask has no bits enabled, which means baking will not produce any proxy meshes for this HLODInstance3D.\nTo resolve this, enable at least one bit in the Bake Mask property."));
+	}
+
+	bool has_proxies = false;
+	for (int i = 0; i < get_child_count(); i++) {
+		if (_is_baked_proxy(get_child(i))) {
+			has_proxies = true;
+			break;
+		}
+	}
+	if (!has_proxies) {
+		warnings.push_back(RTR("No proxy meshes have been baked yet, so no instances will be merged by this HLODInstance3D.\nTo resolve this, select the HLODInstance3D then use the Bake HLOD button at the top of the 3D editor viewport."));
+	}
+
+	return warnings;
+}
+
+void HLODInstance3D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_bake_mask", "mask"), &HLODInstance3D::set_bake_mask);
+	ClassDB::bind_method(D_METHOD("get_bake_mask"), &HLODInstance3D::get_bake_mask);
+	ClassDB::bind_method(D_METHOD("set_bake_mask_value", "layer_number", "value"), &HLODInstance3D::set_bake_mask_value);
+	ClassDB::bind_method(D_METHOD("get_bake_mask_value", "layer_number"), &HLODInstance3D::get_bake_mask_value);
+	ClassDB::bind_method(D_METHOD("set_bake_cell_size", "size"), &HLODInstance3D::set_bake_cell_size);
+	ClassDB::bind_method(D_METHOD("get_bake_cell_size"), &HLODInstance3D::get_bake_cell_size);
+	ClassDB::bind_method(D_METHOD("set_bake_simplification_distance", "simplification_distance"), &HLODInstance3D::set_bake_simplification_distance);
+	ClassDB::bind_method(D_METHOD("get_bake_simplification_distance"), &HLODInstance3D::get_bake_simplification_distance);
+	ClassDB::bind_method(D_METHOD("set_bake_min_instances", "count"), &HLODInstance3D::set_bake_min_instances);
+	ClassDB::bind_method(D_METHOD("get_bake_min_instances"), &HLODInstance3D::get_bake_min_instances);
+
+	ClassDB::bind_method(D_METHOD("set_proxy_distance", "distance"), &HLODInstance3D::set_proxy_distance);
+	ClassDB::bind_method(D_METHOD("get_proxy_distance"), &HLODInstance3D::get_proxy_distance);
+	ClassDB::bind_method(D_METHOD("set_proxy_distance_margin", "margin"), &HLODInstance3D::set_proxy_distance_margin);
+	ClassDB::bind_method(D_METHOD("get_proxy_distance_margin"), &HLODInstance3D::get_proxy_distance_margin);
+
+	ClassDB::bind_method(D_METHOD("bake", "from_node"), &HLODInstance3D::bake);
+	ClassDB::bind_method(D_METHOD("clear_proxies"), &HLODInstance3D::clear_proxies);
+
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "proxy_distance", PROPERTY_HINT_RANGE, "0.0,4096.0,0.01,or_greater,suffix:m"), "set_proxy_distance", "get_proxy_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "proxy_distance_margin", PROPERTY_HINT_RANGE, "0.0,4096.0,0.01,or_greater,suffix:m"), "set_proxy_distance_margin", "get_proxy_distance_margin");
+	ADD_GROUP("Bake", "bake_");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "bake_mask", PROPERTY_HINT_LAYERS_3D_RENDER), "set_bake_mask", "get_bake_mask");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "bake_cell_size", PROPERTY_HINT_RANGE, "0.01,1024.0,0.01,or_greater,suffix:m"), "set_bake_cell_size", "get_bake_cell_size");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "bake_simplification_distance", PROPERTY_HINT_RANGE, "0.0,10.0,0.01,or_greater,suffix:m"), "set_bake_simplification_distance", "get_bake_simplification_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "bake_min_instances", PROPERTY_HINT_RANGE, "1,64,1,or_greater"), "set_bake_min_instances", "get_bake_min_instances");
+
+	BIND_ENUM_CONSTANT(BAKE_ERROR_OK);
+	BIND_ENUM_CONSTANT(BAKE_ERROR_NOT_IN_TREE);
+	BIND_ENUM_CONSTANT(BAKE_ERROR_NO_MESHES);
+}
+
+HLODInstance3D::HLODInstance3D() {
+}
+
+HLODInstance3D::~HLODInstance3D() {
+}
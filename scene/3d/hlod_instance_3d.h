@@ -0,0 +1,98 @@
+/**************************************************************************/
+/*  hlod_instance_3d.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef HLOD_INSTANCE_3D_H
+#define HLOD_INSTANCE_3D_H
+
+#include "scene/3d/node_3d.h"
+#include "scene/resources/mesh.h"
+
+class MeshInstance3D;
+
+class HLODInstance3D : public Node3D {
+	GDCLASS(HLODInstance3D, Node3D);
+
+	uint32_t bake_mask = 0xFFFFFFFF;
+	float bake_cell_size = 32.0f;
+	float bake_simplification_distance = 0.5f;
+	int bake_min_instances = 2;
+	float proxy_distance = 100.0f;
+	float proxy_distance_margin = 0.0f;
+
+	bool _is_baked_proxy(const Node *p_node) const;
+	bool _bake_material_check(const Ref<Material> &p_material) const;
+	bool _bake_surface_check(const MeshInstance3D *p_instance, int p_surface) const;
+	void _bake_collect(Node *p_node, LocalVector<MeshInstance3D *> &r_instances);
+	Ref<ArrayMesh> _bake_cluster(const LocalVector<MeshInstance3D *> &p_instances) const;
+	void _update_proxies();
+
+protected:
+	static void _bind_methods();
+
+public:
+	enum BakeError {
+		BAKE_ERROR_OK,
+		BAKE_ERROR_NOT_IN_TREE,
+		BAKE_ERROR_NO_MESHES,
+	};
+
+	virtual PackedStringArray get_configuration_warnings() const override;
+
+	void set_bake_mask(uint32_t p_mask);
+	uint32_t get_bake_mask() const;
+
+	void set_bake_mask_value(int p_layer_number, bool p_enable);
+	bool get_bake_mask_value(int p_layer_number) const;
+
+	void set_bake_cell_size(float p_size);
+	float get_bake_cell_size() const;
+
+	void set_bake_simplification_distance(float p_dist);
+	float get_bake_simplification_distance() const;
+
+	void set_bake_min_instances(int p_count);
+	int get_bake_min_instances() const;
+
+	void set_proxy_distance(float p_dist);
+	float get_proxy_distance() const;
+
+	void set_proxy_distance_margin(float p_margin);
+	float get_proxy_distance_margin() const;
+
+	BakeError bake(Node *p_from_node);
+	void clear_proxies();
+
+	HLODInstance3D();
+	~HLODInstance3D();
+};
+
+VARIANT_ENUM_CAST(HLODInstance3D::BakeError);
+
+#endif // HLOD_INSTANCE_3D_H
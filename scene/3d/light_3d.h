@@ -74,6 +74,7 @@ private:
 	bool shadow = false;
 	bool negative = false;
 	bool reverse_cull = false;
+	bool shadow_caster_cache = false;
 	uint32_t cull_mask = 0;
 	bool distance_fade_enabled = false;
 	real_t distance_fade_begin = 40.0;
@@ -136,6 +137,9 @@ public:
 	void set_shadow_reverse_cull_face(bool p_enable);
 	bool get_shadow_reverse_cull_face() const;
 
+	void set_shadow_caster_cache(bool p_enable);
+	bool get_shadow_caster_cache() const;
+
 	void set_bake_mode(BakeMode p_mode);
 	BakeMode get_bake_mode() const;
 
@@ -35,6 +35,7 @@
 #include "scene/3d/skeleton_3d.h"
 #include "scene/resources/3d/concave_polygon_shape_3d.h"
 #include "scene/resources/3d/convex_polygon_shape_3d.h"
+#include "servers/rendering/cpu_skinning.h"
 
 bool MeshInstance3D::_set(const StringName &p_name, const Variant &p_value) {
 	//this is not _too_ bad performance wise, really. it only arrives here if the property was not set anywhere else.
@@ -515,6 +516,82 @@ bool MeshInstance3D::_property_get_revert(const StringName &p_name, Variant &r_p
 	return false;
 }
 
+Array MeshInstance3D::_get_blended_surface_arrays(const Ref<ArrayMesh> &p_mesh, int p_surface) const {
+	Array arrays = p_mesh->surface_get_arrays(p_surface);
+	ERR_FAIL_COND_V(arrays.size() != RS::ARRAY_MAX, Array());
+
+	PackedVector3Array vertex_array = arrays[Mesh::ARRAY_VERTEX];
+	PackedVector3Array normal_array = arrays[Mesh::ARRAY_NORMAL];
+	PackedFloat32Array tangent_array = arrays[Mesh::ARRAY_TANGENT];
+
+	bool use_normal_array = normal_array.size() == vertex_array.size();
+	bool use_tangent_array = tangent_array.size() / 4 == vertex_array.size();
+
+	const Array &blend_shape_arrays = p_mesh->surface_get_blend_shape_arrays(p_surface);
+	int blend_shape_count = MIN(p_mesh->get_blend_shape_count(), (int)blend_shape_tracks.size());
+	ERR_FAIL_COND_V(blend_shape_arrays.size() != p_mesh->get_blend_shape_count(), Array());
+
+	// The blend shape arrays must stay alive while the kernel reads from them.
+	LocalVector<PackedVector3Array> blend_shape_data;
+	LocalVector<PackedFloat32Array> blend_shape_tangents;
+	LocalVector<CPUSkinning::BlendShape> blend_shapes;
+	blend_shape_data.reserve(blend_shape_count * 2);
+	blend_shape_tangents.reserve(blend_shape_count);
+
+	for (int i = 0; i < blend_shape_count; i++) {
+		float weight = blend_shape_tracks[i];
+		if (Math::abs(weight) <= 0.0001f) {
+			continue;
+		}
+
+		const Array &shape_arrays = blend_shape_arrays[i];
+		blend_shape_data.push_back(shape_arrays[Mesh::ARRAY_VERTEX]);
+		const PackedVector3Array &shape_vertices = blend_shape_data[blend_shape_data.size() - 1];
+		blend_shape_data.push_back(shape_arrays[Mesh::ARRAY_NORMAL]);
+		const PackedVector3Array &shape_normals = blend_shape_data[blend_shape_data.size() - 1];
+		blend_shape_tangents.push_back(shape_arrays[Mesh::ARRAY_TANGENT]);
+		const PackedFloat32Array &shape_tangents = blend_shape_tangents[blend_shape_tangents.size() - 1];
+
+		ERR_FAIL_COND_V(shape_vertices.size() != vertex_array.size(), Array());
+		ERR_FAIL_COND_V(use_normal_array && shape_normals.size() != normal_array.size(), Array());
+		ERR_FAIL_COND_V(use_tangent_array && shape_tangents.size() != tangent_array.size(), Array());
+
+		CPUSkinning::BlendShape shape;
+		shape.vertices = shape_vertices.ptr();
+		shape.normals = use_normal_array ? shape_normals.ptr() : nullptr;
+		shape.tangents = use_tangent_array ? shape_tangents.ptr() : nullptr;
+		shape.weight = weight;
+		blend_shapes.push_back(shape);
+	}
+
+	if (blend_shapes.is_empty()) {
+		return arrays;
+	}
+
+	CPUSkinning::Surface surface;
+	surface.vertex_count = vertex_array.size();
+	surface.vertices = vertex_array.ptr();
+	surface.normals = use_normal_array ? normal_array.ptr() : nullptr;
+	surface.tangents = use_tangent_array ? tangent_array.ptr() : nullptr;
+
+	CPUSkinning::Output output;
+	output.vertices = vertex_array.ptrw();
+	output.normals = use_normal_array ? normal_array.ptrw() : nullptr;
+	output.tangents = use_tangent_array ? tangent_array.ptrw() : nullptr;
+
+	CPUSkinning::blend_shapes(surface, RS::BlendShapeMode(p_mesh->get_blend_shape_mode()), blend_shapes.ptr(), blend_shapes.size(), output);
+
+	arrays[Mesh::ARRAY_VERTEX] = vertex_array;
+	if (use_normal_array) {
+		arrays[Mesh::ARRAY_NORMAL] = normal_array;
+	}
+	if (use_tangent_array) {
+		arrays[Mesh::ARRAY_TANGENT] = tangent_array;
+	}
+
+	return arrays;
+}
+
 Ref<ArrayMesh> MeshInstance3D::bake_mesh_from_current_blend_shape_mix(Ref<ArrayMesh> p_existing) {
 	Ref<ArrayMesh> source_mesh = get_mesh();
 	ERR_FAIL_NULL_V_MSG(source_mesh, Ref<ArrayMesh>(), "The source mesh must be a valid ArrayMesh.");
@@ -541,131 +618,98 @@ Ref<ArrayMesh> MeshInstance3D::bake_mesh_from_current_blend_shape_mix(Ref<ArrayM
 
 		ERR_CONTINUE(0 == (surface_format & Mesh::ARRAY_FORMAT_VERTEX));
 
-		const Array &source_mesh_arrays = source_mesh->surface_get_arrays(surface_index);
+		Array new_mesh_arrays = _get_blended_surface_arrays(source_mesh, surface_index);
+		ERR_FAIL_COND_V(new_mesh_arrays.is_empty(), Ref<ArrayMesh>());
+
+		bake_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, new_mesh_arrays, Array(), Dictionary(), surface_format);
+	}
+
+	return bake_mesh;
+}
 
-		ERR_FAIL_COND_V(source_mesh_arrays.size() != RS::ARRAY_MAX, Ref<ArrayMesh>());
+Ref<ArrayMesh> MeshInstance3D::bake_mesh_from_current_skeleton_pose(Ref<ArrayMesh> p_existing) {
+	Ref<ArrayMesh> source_mesh = get_mesh();
+	ERR_FAIL_NULL_V_MSG(source_mesh, Ref<ArrayMesh>(), "The source mesh must be a valid ArrayMesh.");
+	ERR_FAIL_COND_V_MSG(skin_ref.is_null(), Ref<ArrayMesh>(), "The MeshInstance3D must be bound to a Skeleton3D to bake its current pose.");
 
-		const Vector<Vector3> &source_mesh_vertex_array = source_mesh_arrays[Mesh::ARRAY_VERTEX];
-		const Vector<Vector3> &source_mesh_normal_array = source_mesh_arrays[Mesh::ARRAY_NORMAL];
-		const Vector<float> &source_mesh_tangent_array = source_mesh_arrays[Mesh::ARRAY_TANGENT];
+	Ref<ArrayMesh> bake_mesh;
 
-		Array new_mesh_arrays;
-		new_mesh_arrays.resize(Mesh::ARRAY_MAX);
-		for (int i = 0; i < source_mesh_arrays.size(); i++) {
-			if (i == Mesh::ARRAY_VERTEX || i == Mesh::ARRAY_NORMAL || i == Mesh::ARRAY_TANGENT) {
-				continue;
-			}
-			new_mesh_arrays[i] = source_mesh_arrays[i];
-		}
+	if (p_existing.is_valid()) {
+		ERR_FAIL_COND_V_MSG(source_mesh == p_existing, Ref<ArrayMesh>(), "The source mesh can not be the same mesh as the existing mesh.");
 
-		bool use_normal_array = source_mesh_normal_array.size() == source_mesh_vertex_array.size();
-		bool use_tangent_array = source_mesh_tangent_array.size() / 4 == source_mesh_vertex_array.size();
+		bake_mesh = p_existing;
+	} else {
+		bake_mesh.instantiate();
+	}
+
+	// Read back the bone transforms the renderer skins with, so the result matches what is drawn.
+	RID skeleton = skin_ref->get_skeleton();
+	uint32_t bone_count = RS::get_singleton()->skeleton_get_bone_count(skeleton);
+	LocalVector<float> bone_transforms;
+	bone_transforms.resize(bone_count * CPUSkinning::BONE_STRIDE_3D);
+	for (uint32_t i = 0; i < bone_count; i++) {
+		CPUSkinning::store_bone_transform(RS::get_singleton()->skeleton_bone_get_transform(skeleton, i), &bone_transforms[i * CPUSkinning::BONE_STRIDE_3D]);
+	}
 
-		Vector<Vector3> lerped_vertex_array = source_mesh_vertex_array;
-		Vector<Vector3> lerped_normal_array = source_mesh_normal_array;
-		Vector<float> lerped_tangent_array = source_mesh_tangent_array;
+	int mesh_surface_count = source_mesh->get_surface_count();
 
-		const Vector3 *source_vertices_ptr = source_mesh_vertex_array.ptr();
-		const Vector3 *source_normals_ptr = source_mesh_normal_array.ptr();
-		const float *source_tangents_ptr = source_mesh_tangent_array.ptr();
+	bake_mesh->clear_surfaces();
 
-		Vector3 *lerped_vertices_ptrw = lerped_vertex_array.ptrw();
-		Vector3 *lerped_normals_ptrw = lerped_normal_array.ptrw();
-		float *lerped_tangents_ptrw = lerped_tangent_array.ptrw();
+	for (int surface_index = 0; surface_index < mesh_surface_count; surface_index++) {
+		uint32_t surface_format = source_mesh->surface_get_format(surface_index);
 
-		const Array &blendshapes_mesh_arrays = source_mesh->surface_get_blend_shape_arrays(surface_index);
-		int blend_shape_count = source_mesh->get_blend_shape_count();
-		ERR_FAIL_COND_V(blendshapes_mesh_arrays.size() != blend_shape_count, Ref<ArrayMesh>());
+		ERR_CONTINUE(0 == (surface_format & Mesh::ARRAY_FORMAT_VERTEX));
 
-		for (int blendshape_index = 0; blendshape_index < blend_shape_count; blendshape_index++) {
-			float blend_weight = get_blend_shape_value(blendshape_index);
-			if (abs(blend_weight) <= 0.0001) {
-				continue;
+		Array arrays = _get_blended_surface_arrays(source_mesh, surface_index);
+		ERR_FAIL_COND_V(arrays.is_empty(), Ref<ArrayMesh>());
+
+		PackedInt32Array bone_array = arrays[Mesh::ARRAY_BONES];
+		PackedFloat32Array weight_array = arrays[Mesh::ARRAY_WEIGHTS];
+		PackedVector3Array vertex_array = arrays[Mesh::ARRAY_VERTEX];
+
+		if ((surface_format & Mesh::ARRAY_FORMAT_BONES) && vertex_array.size() > 0) {
+			uint32_t influences = (surface_format & Mesh::ARRAY_FLAG_USE_8_BONE_WEIGHTS) ? 8 : 4;
+			ERR_FAIL_COND_V(bone_array.size() != vertex_array.size() * (int)influences || weight_array.size() != bone_array.size(), Ref<ArrayMesh>());
+
+			PackedVector3Array normal_array = arrays[Mesh::ARRAY_NORMAL];
+			PackedFloat32Array tangent_array = arrays[Mesh::ARRAY_TANGENT];
+			bool use_normal_array = normal_array.size() == vertex_array.size();
+			bool use_tangent_array = tangent_array.size() / 4 == vertex_array.size();
+
+			CPUSkinning::Surface surface;
+			surface.vertex_count = vertex_array.size();
+			surface.vertices = vertex_array.ptr();
+			surface.normals = use_normal_array ? normal_array.ptr() : nullptr;
+			surface.tangents = use_tangent_array ? tangent_array.ptr() : nullptr;
+
+			CPUSkinning::Skin skin_data;
+			skin_data.bones = bone_array.ptr();
+			skin_data.weights = weight_array.ptr();
+			skin_data.influences = influences;
+			skin_data.bone_transforms = bone_transforms.ptr();
+			skin_data.bone_count = bone_count;
+
+			CPUSkinning::Output output;
+			output.vertices = vertex_array.ptrw();
+			output.normals = use_normal_array ? normal_array.ptrw() : nullptr;
+			output.tangents = use_tangent_array ? tangent_array.ptrw() : nullptr;
+
+			CPUSkinning::skin(surface, skin_data, output);
+
+			arrays[Mesh::ARRAY_VERTEX] = vertex_array;
+			if (use_normal_array) {
+				arrays[Mesh::ARRAY_NORMAL] = normal_array;
 			}
-
-			const Array &blendshape_mesh_arrays = blendshapes_mesh_arrays[blendshape_index];
-
-			const Vector<Vector3> &blendshape_vertex_array = blendshape_mesh_arrays[Mesh::ARRAY_VERTEX];
-			const Vector<Vector3> &blendshape_normal_array = blendshape_mesh_arrays[Mesh::ARRAY_NORMAL];
-			const Vector<float> &blendshape_tangent_array = blendshape_mesh_arrays[Mesh::ARRAY_TANGENT];
-
-			ERR_FAIL_COND_V(source_mesh_vertex_array.size() != blendshape_vertex_array.size(), Ref<ArrayMesh>());
-			ERR_FAIL_COND_V(source_mesh_normal_array.size() != blendshape_normal_array.size(), Ref<ArrayMesh>());
-			ERR_FAIL_COND_V(source_mesh_tangent_array.size() != blendshape_tangent_array.size(), Ref<ArrayMesh>());
-
-			const Vector3 *blendshape_vertices_ptr = blendshape_vertex_array.ptr();
-			const Vector3 *blendshape_normals_ptr = blendshape_normal_array.ptr();
-			const float *blendshape_tangents_ptr = blendshape_tangent_array.ptr();
-
-			if (blend_shape_mode == Mesh::BLEND_SHAPE_MODE_NORMALIZED) {
-				for (int i = 0; i < source_mesh_vertex_array.size(); i++) {
-					const Vector3 &source_vertex = source_vertices_ptr[i];
-					const Vector3 &blendshape_vertex = blendshape_vertices_ptr[i];
-					Vector3 lerped_vertex = source_vertex.lerp(blendshape_vertex, blend_weight) - source_vertex;
-					lerped_vertices_ptrw[i] += lerped_vertex;
-
-					if (use_normal_array) {
-						const Vector3 &source_normal = source_normals_ptr[i];
-						const Vector3 &blendshape_normal = blendshape_normals_ptr[i];
-						Vector3 lerped_normal = source_normal.lerp(blendshape_normal, blend_weight) - source_normal;
-						lerped_normals_ptrw[i] += lerped_normal;
-					}
-
-					if (use_tangent_array) {
-						int tangent_index = i * 4;
-						const Vector4 source_tangent = Vector4(
-								source_tangents_ptr[tangent_index],
-								source_tangents_ptr[tangent_index + 1],
-								source_tangents_ptr[tangent_index + 2],
-								source_tangents_ptr[tangent_index + 3]);
-						const Vector4 blendshape_tangent = Vector4(
-								blendshape_tangents_ptr[tangent_index],
-								blendshape_tangents_ptr[tangent_index + 1],
-								blendshape_tangents_ptr[tangent_index + 2],
-								blendshape_tangents_ptr[tangent_index + 3]);
-						Vector4 lerped_tangent = source_tangent.lerp(blendshape_tangent, blend_weight);
-						lerped_tangents_ptrw[tangent_index] += lerped_tangent.x;
-						lerped_tangents_ptrw[tangent_index + 1] += lerped_tangent.y;
-						lerped_tangents_ptrw[tangent_index + 2] += lerped_tangent.z;
-						lerped_tangents_ptrw[tangent_index + 3] += lerped_tangent.w;
-					}
-				}
-			} else if (blend_shape_mode == Mesh::BLEND_SHAPE_MODE_RELATIVE) {
-				for (int i = 0; i < source_mesh_vertex_array.size(); i++) {
-					const Vector3 &blendshape_vertex = blendshape_vertices_ptr[i];
-					lerped_vertices_ptrw[i] += blendshape_vertex * blend_weight;
-
-					if (use_normal_array) {
-						const Vector3 &blendshape_normal = blendshape_normals_ptr[i];
-						lerped_normals_ptrw[i] += blendshape_normal * blend_weight;
-					}
-
-					if (use_tangent_array) {
-						int tangent_index = i * 4;
-						const Vector4 blendshape_tangent = Vector4(
-								blendshape_tangents_ptr[tangent_index],
-								blendshape_tangents_ptr[tangent_index + 1],
-								blendshape_tangents_ptr[tangent_index + 2],
-								blendshape_tangents_ptr[tangent_index + 3]);
-						Vector4 lerped_tangent = blendshape_tangent * blend_weight;
-						lerped_tangents_ptrw[tangent_index] += lerped_tangent.x;
-						lerped_tangents_ptrw[tangent_index + 1] += lerped_tangent.y;
-						lerped_tangents_ptrw[tangent_index + 2] += lerped_tangent.z;
-						lerped_tangents_ptrw[tangent_index + 3] += lerped_tangent.w;
-					}
-				}
+			if (use_tangent_array) {
+				arrays[Mesh::ARRAY_TANGENT] = tangent_array;
 			}
 		}
 
-		new_mesh_arrays[Mesh::ARRAY_VERTEX] = lerped_vertex_array;
-		if (use_normal_array) {
-			new_mesh_arrays[Mesh::ARRAY_NORMAL] = lerped_normal_array;
-		}
-		if (use_tangent_array) {
-			new_mesh_arrays[Mesh::ARRAY_TANGENT] = lerped_tangent_array;
-		}
+		// The baked mesh is static, so it doesn't need the skin attributes anymore.
+		arrays[Mesh::ARRAY_BONES] = Variant();
+		arrays[Mesh::ARRAY_WEIGHTS] = Variant();
 
-		bake_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, new_mesh_arrays, Array(), Dictionary(), surface_format);
+		bake_mesh->add_surface_from_arrays(source_mesh->surface_get_primitive_type(surface_index), arrays, Array(), Dictionary(), surface_format & ~uint64_t(Mesh::ARRAY_FLAG_USE_8_BONE_WEIGHTS));
 	}
 
 	return bake_mesh;
@@ -700,6 +744,7 @@ void MeshInstance3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_debug_tangents"), &MeshInstance3D::create_debug_tangents);
 
 	ClassDB::bind_method(D_METHOD("bake_mesh_from_current_blend_shape_mix", "existing"), &MeshInstance3D::bake_mesh_from_current_blend_shape_mix, DEFVAL(Ref<ArrayMesh>()));
+	ClassDB::bind_method(D_METHOD("bake_mesh_from_current_skeleton_pose", "existing"), &MeshInstance3D::bake_mesh_from_current_skeleton_pose, DEFVAL(Ref<ArrayMesh>()));
 
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "mesh", PROPERTY_HINT_RESOURCE_TYPE, "Mesh"), "set_mesh", "get_mesh");
 	ADD_GROUP("Skeleton", "");
@@ -52,6 +52,7 @@ protected:
 
 	void _mesh_changed();
 	void _resolve_skeleton_path();
+	Array _get_blended_surface_arrays(const Ref<ArrayMesh> &p_mesh, int p_surface) const;
 
 protected:
 	bool _set(const StringName &p_name, const Variant &p_value);
@@ -102,6 +103,7 @@ public:
 	virtual AABB get_aabb() const override;
 
 	Ref<ArrayMesh> bake_mesh_from_current_blend_shape_mix(Ref<ArrayMesh> p_existing = Ref<ArrayMesh>());
+	Ref<ArrayMesh> bake_mesh_from_current_skeleton_pose(Ref<ArrayMesh> p_existing = Ref<ArrayMesh>());
 
 	MeshInstance3D();
 	~MeshInstance3D();
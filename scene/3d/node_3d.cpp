@@ -108,6 +108,13 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	uint32_t epoch = get_tree()->xform_change_epoch.get();
+	if (data.propagated_epoch == epoch && !is_group_processing() && _test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+		// Already propagated through here since the last notification flush and nothing read the global transform since,
+		// so the whole subtree is still dirty and queued. Moving many nodes of a hierarchy per frame stays linear this way.
+		return;
+	}
+
 	for (Node3D *&E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
@@ -127,6 +134,23 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		}
 	}
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+
+	if (!data.ignore_notification) {
+		data.propagated_epoch = epoch;
+	} else if (p_origin != this) {
+		// The notification was skipped, so marked ancestors must not hide it once notifications are enabled again.
+		data.ignored_propagation = true;
+	}
+}
+
+void Node3D::set_ignore_transform_notification(bool p_ignore) {
+	data.ignore_notification = p_ignore;
+	if (!p_ignore && data.ignored_propagation) {
+		data.ignored_propagation = false;
+		if (is_inside_tree()) {
+			get_tree()->xform_change_epoch.increment();
+		}
+	}
 }
 
 void Node3D::_notification(int p_what) {
@@ -159,6 +183,8 @@ void Node3D::_notification(int p_what) {
 
 			_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM); // Global is always dirty upon entering a scene.
 			_notify_dirty();
+			// Ancestors that propagated a change already in this epoch didn't visit this node, so they must not skip it later.
+			get_tree()->xform_change_epoch.increment();
 
 			notification(NOTIFICATION_ENTER_WORLD);
 			_update_visibility_parent(true);
@@ -612,6 +638,9 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	if (is_inside_tree()) {
+		get_tree()->xform_change_epoch.increment();
+	}
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -967,6 +996,9 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
+	if (p_enabled && !data.notify_transform && is_inside_tree()) {
+		get_tree()->xform_change_epoch.increment();
+	}
 	data.notify_transform = p_enabled;
 }
 
@@ -992,6 +1024,7 @@ void Node3D::force_update_transform() {
 		return; //nothing to update
 	}
 	get_tree()->xform_change_list.remove(&xform_change);
+	get_tree()->xform_change_epoch.increment();
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
@@ -110,6 +110,10 @@ private:
 		List<Node3D *> children;
 		List<Node3D *>::Element *C = nullptr;
 
+		// Value of SceneTree::xform_change_epoch when the transform change was last propagated through this node.
+		uint32_t propagated_epoch = 0;
+		bool ignored_propagation = false;
+
 		bool ignore_notification = false;
 		bool notify_local_transform = false;
 		bool notify_transform = false;
@@ -145,7 +149,7 @@ private:
 	void _propagate_transform_changed_deferred();
 
 protected:
-	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
+	void set_ignore_transform_notification(bool p_ignore);
 
 	_FORCE_INLINE_ void _update_local_transform() const;
 	_FORCE_INLINE_ void _update_rotation_and_scale() const;
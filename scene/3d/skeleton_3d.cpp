@@ -264,7 +264,66 @@ void Skeleton3D::_update_process_order() {
 		}
 	}
 
-	bones_backup.resize(bones.size());
+	// Flatten the hierarchy.
+	process_order.clear();
+	process_position.resize(len);
+	process_parent.resize(len);
+	process_subtree_end.resize(len);
+	for (int i = 0; i < len; i++) {
+		process_position[i] = -1;
+	}
+
+	LocalVector<int> stack;
+	for (int i = parentless_bones.size() - 1; i >= 0; i--) {
+		stack.push_back(parentless_bones[i]);
+	}
+	while (true) {
+		if (stack.is_empty()) {
+			// Bones which are part of a cycle are never reached from a root, process them as roots.
+			for (int i = 0; i < len; i++) {
+				if (process_position[i] < 0) {
+					stack.push_back(i);
+					break;
+				}
+			}
+			if (stack.is_empty()) {
+				break;
+			}
+		}
+
+		int bone_idx = stack[stack.size() - 1];
+		stack.resize(stack.size() - 1);
+		if (process_position[bone_idx] >= 0) {
+			continue;
+		}
+
+		int position = process_order.size();
+		int parent = bonesptr[bone_idx].parent;
+		process_order.push_back(bone_idx);
+		process_position[bone_idx] = position;
+		process_parent[position] = parent >= 0 && process_position[parent] >= 0 ? process_position[parent] : -1;
+		process_subtree_end[position] = position + 1;
+
+		const Vector<int> &children = bonesptr[bone_idx].child_bones;
+		for (int i = children.size() - 1; i >= 0; i--) {
+			stack.push_back(children[i]);
+		}
+	}
+
+	for (int i = len - 1; i >= 0; i--) {
+		if (process_parent[i] >= 0) {
+			process_subtree_end[process_parent[i]] = MAX(process_subtree_end[process_parent[i]], process_subtree_end[i]);
+		}
+	}
+
+	local_poses.resize(len);
+	global_poses.resize(len);
+	bones_backup.resize(len);
+
+	// Positions have changed, so every pose must be propagated again.
+	dirty = true;
+	dirty_range_begin = 0;
+	dirty_range_end = len;
 
 	process_order_dirty = false;
 
@@ -311,6 +370,7 @@ void Skeleton3D::_notification(int p_what) {
 				for (int i = 0; i < bones.size(); i++) {
 					bones_backup[i].save(bones[i]);
 				}
+				global_poses_backup = global_poses;
 				_process_modifiers();
 			}
 
@@ -369,7 +429,7 @@ void Skeleton3D::_notification(int p_what) {
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
 					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].global_pose * skin->get_bind_pose(i));
+					rs->skeleton_bone_set_transform(skeleton, i, global_poses[process_position[bone_index]] * skin->get_bind_pose(i));
 				}
 			}
 
@@ -378,6 +438,7 @@ void Skeleton3D::_notification(int p_what) {
 				for (int i = 0; i < bones.size(); i++) {
 					bones_backup[i].restore(bones.write[i]);
 				}
+				global_poses = global_poses_backup;
 			}
 
 			updating = false;
@@ -424,7 +485,7 @@ Transform3D Skeleton3D::get_bone_global_pose(int p_bone) const {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX_V(p_bone, bone_size, Transform3D());
 	const_cast<Skeleton3D *>(this)->force_update_all_dirty_bones();
-	return bones[p_bone].global_pose;
+	return global_poses[process_position[p_bone]];
 }
 
 void Skeleton3D::set_bone_global_pose(int p_bone, const Transform3D &p_pose) {
@@ -644,7 +705,7 @@ void Skeleton3D::set_bone_pose(int p_bone, const Transform3D &p_pose) {
 	bones.write[p_bone].pose_scale = p_pose.basis.get_scale();
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_dirty(p_bone);
 	}
 }
 
@@ -655,7 +716,7 @@ void Skeleton3D::set_bone_pose_position(int p_bone, const Vector3 &p_position) {
 	bones.write[p_bone].pose_position = p_position;
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_dirty(p_bone);
 	}
 }
 void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation) {
@@ -665,7 +726,7 @@ void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation
 	bones.write[p_bone].pose_rotation = p_rotation;
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_dirty(p_bone);
 	}
 }
 void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
@@ -675,7 +736,7 @@ void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
 	bones.write[p_bone].pose_scale = p_scale;
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_dirty(p_bone);
 	}
 }
 
@@ -719,6 +780,8 @@ Transform3D Skeleton3D::get_bone_pose(int p_bone) const {
 }
 
 void Skeleton3D::_make_dirty() {
+	dirty_range_begin = 0;
+	dirty_range_end = INT_MAX;
 	if (dirty) {
 		return;
 	}
@@ -726,6 +789,26 @@ void Skeleton3D::_make_dirty() {
 	_update_deferred();
 }
 
+void Skeleton3D::_make_bone_dirty(int p_bone) {
+	if (process_order_dirty) {
+		_make_dirty();
+		return;
+	}
+
+	// Only the subtree of the bone needs to be propagated again.
+	int begin = process_position[p_bone];
+	int end = process_subtree_end[begin];
+	if (dirty) {
+		dirty_range_begin = MIN(dirty_range_begin, begin);
+		dirty_range_end = MAX(dirty_range_end, end);
+		return;
+	}
+	dirty_range_begin = begin;
+	dirty_range_end = end;
+	dirty = true;
+	_update_deferred();
+}
+
 void Skeleton3D::_update_deferred() {
 	if (!is_update_needed && !updating && is_inside_tree()) {
 		is_update_needed = true;
@@ -827,16 +910,32 @@ void Skeleton3D::force_update_all_dirty_bones() {
 	if (!dirty) {
 		return;
 	}
-	force_update_all_bone_transforms();
+	bool full_update = rest_dirty || process_order_dirty || (dirty_range_begin == 0 && dirty_range_end >= (int)process_order.size());
+#ifndef DISABLE_DEPRECATED
+	full_update = full_update || global_pose_override_used;
+#endif // _DISABLE_DEPRECATED
+	if (full_update) {
+		force_update_all_bone_transforms();
+		return;
+	}
+
+	_update_bone_range(dirty_range_begin, dirty_range_end);
+	dirty = false;
+	dirty_range_begin = 0;
+	dirty_range_end = 0;
+	if (updating) {
+		return;
+	}
+	emit_signal(SceneStringNames::get_singleton()->pose_updated);
 }
 
 void Skeleton3D::force_update_all_bone_transforms() {
 	_update_process_order();
-	for (int i = 0; i < parentless_bones.size(); i++) {
-		force_update_bone_children_transforms(parentless_bones[i]);
-	}
+	_update_bone_range(0, process_order.size());
 	rest_dirty = false;
 	dirty = false;
+	dirty_range_begin = 0;
+	dirty_range_end = 0;
 	if (updating) {
 		return;
 	}
@@ -847,65 +946,61 @@ void Skeleton3D::force_update_bone_children_transforms(int p_bone_idx) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone_idx, bone_size);
 
-	Bone *bonesptr = bones.ptrw();
-	List<int> bones_to_process = List<int>();
-	bones_to_process.push_back(p_bone_idx);
-
-	while (bones_to_process.size() > 0) {
-		int current_bone_idx = bones_to_process.front()->get();
-		bones_to_process.erase(current_bone_idx);
-
-		Bone &b = bonesptr[current_bone_idx];
-		bool bone_enabled = b.enabled && !show_rest_only;
+	_update_process_order();
+	int position = process_position[p_bone_idx];
+	_update_bone_range(position, process_subtree_end[position]);
+}
 
-		if (bone_enabled) {
+void Skeleton3D::_update_bone_range(int p_begin, int p_end) {
+	Bone *bonesptr = bones.ptrw();
+	const int *order = process_order.ptr();
+	const int *parents = process_parent.ptr();
+	Transform3D *local = local_poses.ptr();
+	Transform3D *global = global_poses.ptr();
+
+	for (int i = p_begin; i < p_end; i++) {
+		Bone &b = bonesptr[order[i]];
+		if (b.enabled && !show_rest_only) {
 			b.update_pose_cache();
-			Transform3D pose = b.pose_cache;
-
-			if (b.parent >= 0) {
-				b.global_pose = bonesptr[b.parent].global_pose * pose;
-			} else {
-				b.global_pose = pose;
-			}
+			local[i] = b.pose_cache;
 		} else {
-			if (b.parent >= 0) {
-				b.global_pose = bonesptr[b.parent].global_pose * b.rest;
-			} else {
-				b.global_pose = b.rest;
-			}
+			local[i] = b.rest;
 		}
-		if (rest_dirty) {
-			b.global_rest = b.parent >= 0 ? bonesptr[b.parent].global_rest * b.rest : b.rest;
+	}
+
+	if (rest_dirty) {
+		for (int i = p_begin; i < p_end; i++) {
+			Bone &b = bonesptr[order[i]];
+			b.global_rest = parents[i] >= 0 ? bonesptr[order[parents[i]]].global_rest * b.rest : b.rest;
 		}
+	}
 
 #ifndef DISABLE_DEPRECATED
-		if (bone_enabled) {
-			Transform3D pose = b.pose_cache;
-			if (b.parent >= 0) {
-				b.pose_global_no_override = bonesptr[b.parent].pose_global_no_override * pose;
+	if (global_pose_override_used) {
+		for (int i = p_begin; i < p_end; i++) {
+			Bone &b = bonesptr[order[i]];
+			if (parents[i] >= 0) {
+				global[i] = global[parents[i]] * local[i];
+				b.pose_global_no_override = bonesptr[order[parents[i]]].pose_global_no_override * local[i];
 			} else {
-				b.pose_global_no_override = pose;
+				global[i] = local[i];
+				b.pose_global_no_override = local[i];
 			}
-		} else {
-			if (b.parent >= 0) {
-				b.pose_global_no_override = bonesptr[b.parent].pose_global_no_override * b.rest;
-			} else {
-				b.pose_global_no_override = b.rest;
+			if (b.global_pose_override_amount >= CMP_EPSILON) {
+				global[i] = global[i].interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+			}
+			if (b.global_pose_override_reset) {
+				b.global_pose_override_amount = 0.0;
 			}
 		}
-		if (b.global_pose_override_amount >= CMP_EPSILON) {
-			b.global_pose = b.global_pose.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
-		}
-		if (b.global_pose_override_reset) {
-			b.global_pose_override_amount = 0.0;
-		}
+		return;
+	}
 #endif // _DISABLE_DEPRECATED
 
-		// Add the bone's children to the list of bones to be processed.
-		int child_bone_size = b.child_bones.size();
-		for (int i = 0; i < child_bone_size; i++) {
-			bones_to_process.push_back(b.child_bones[i]);
-		}
+	// Parents always come first, so this is a single linear pass over the flat arrays.
+	for (int i = p_begin; i < p_end; i++) {
+		const int parent = parents[i];
+		global[i] = parent >= 0 ? global[parent] * local[i] : local[i];
 	}
 }
 
@@ -1072,6 +1167,7 @@ void Skeleton3D::clear_bones_global_pose_override() {
 		bones.write[i].global_pose_override_amount = 0;
 		bones.write[i].global_pose_override_reset = true;
 	}
+	global_pose_override_used = false;
 	_make_dirty();
 }
 
@@ -1081,6 +1177,7 @@ void Skeleton3D::set_bone_global_pose_override(int p_bone, const Transform3D &p_
 	bones.write[p_bone].global_pose_override_amount = p_amount;
 	bones.write[p_bone].global_pose_override = p_pose;
 	bones.write[p_bone].global_pose_override_reset = !p_persistent;
+	global_pose_override_used = true;
 	_make_dirty();
 }
 
@@ -1094,6 +1191,9 @@ Transform3D Skeleton3D::get_bone_global_pose_no_override(int p_bone) const {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX_V(p_bone, bone_size, Transform3D());
 	const_cast<Skeleton3D *>(this)->force_update_all_dirty_bones();
+	if (!global_pose_override_used) {
+		return global_poses[process_position[p_bone]]; // Not tracked separately while no override is set.
+	}
 	return bones[p_bone].pose_global_no_override;
 }
 
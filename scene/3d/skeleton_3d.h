@@ -99,7 +99,6 @@ private:
 		Vector3 pose_position;
 		Quaternion pose_rotation;
 		Vector3 pose_scale = Vector3(1, 1, 1);
-		Transform3D global_pose;
 
 		void update_pose_cache() {
 			if (pose_cache_dirty) {
@@ -122,14 +121,12 @@ private:
 		Vector3 pose_position;
 		Quaternion pose_rotation;
 		Vector3 pose_scale = Vector3(1, 1, 1);
-		Transform3D global_pose;
 
 		void save(const Bone &p_bone) {
 			pose_cache = p_bone.pose_cache;
 			pose_position = p_bone.pose_position;
 			pose_rotation = p_bone.pose_rotation;
 			pose_scale = p_bone.pose_scale;
-			global_pose = p_bone.global_pose;
 		}
 
 		void restore(Bone &r_bone) {
@@ -137,7 +134,6 @@ private:
 			r_bone.pose_position = pose_position;
 			r_bone.pose_rotation = pose_rotation;
 			r_bone.pose_scale = pose_scale;
-			r_bone.global_pose = global_pose;
 		}
 	};
 
@@ -150,9 +146,23 @@ private:
 	Vector<int> parentless_bones;
 	HashMap<String, int> name_to_bone_index;
 
+	// Poses are propagated in depth-first order, so parents come before their children and every subtree is a contiguous range.
+	LocalVector<int> process_order; // Bone index at each process position.
+	LocalVector<int> process_position; // Process position of each bone.
+	LocalVector<int> process_parent; // Process position of the parent, or -1.
+	LocalVector<int> process_subtree_end; // End of the subtree starting at each process position.
+	LocalVector<Transform3D> local_poses; // Indexed by process position.
+	LocalVector<Transform3D> global_poses; // Indexed by process position.
+	LocalVector<Transform3D> global_poses_backup;
+
 	void _make_dirty();
+	void _make_bone_dirty(int p_bone);
 	bool dirty = false;
 	bool rest_dirty = false;
+	int dirty_range_begin = 0; // Range of process positions to update, when only some poses changed.
+	int dirty_range_end = 0;
+
+	void _update_bone_range(int p_begin, int p_end);
 
 	bool show_rest_only = false;
 	float motion_scale = 1.0;
@@ -172,6 +182,8 @@ private:
 	LocalVector<BonePoseBackup> bones_backup;
 
 #ifndef DISABLE_DEPRECATED
+	bool global_pose_override_used = false;
+
 	void _add_bone_bind_compat_88791(const String &p_name);
 
 	static void _bind_compatibility_methods();
@@ -57,10 +57,18 @@ void VisualInstance3D::_notification(int p_what) {
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
 			Transform3D gt = get_global_transform();
-			RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			if (is_inside_tree() && get_tree()->xform_batching && Thread::is_main_thread()) {
+				// Flushing transform notifications, the tree submits all changed instances in one call.
+				get_tree()->xform_batch_instances.push_back(instance);
+				get_tree()->xform_batch_transforms.push_back(gt);
+			} else {
+				RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			}
 		} break;
 
 		case NOTIFICATION_EXIT_WORLD: {
+			// The instance may be freed right after leaving the tree, don't leave it in a pending batch.
+			get_tree()->_flush_instance_transforms();
 			RenderingServer::get_singleton()->instance_set_scenario(instance, RID());
 			RenderingServer::get_singleton()->instance_attach_skeleton(instance, RID());
 		} break;
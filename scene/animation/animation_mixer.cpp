@@ -33,16 +33,20 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/animation/animation_player.h"
 #include "scene/resources/animation.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
 
 #ifndef _3D_DISABLED
+#include "scene/3d/camera_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
 #include "scene/3d/skeleton_modifier_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
+#include "scene/main/viewport.h"
 #endif // _3D_DISABLED
 
 #ifdef TOOLS_ENABLED
@@ -470,6 +474,59 @@ bool AnimationMixer::is_deterministic() const {
 	return deterministic;
 }
 
+void AnimationMixer::set_batch_evaluation_enabled(bool p_enabled) {
+	batch_evaluation = p_enabled;
+}
+
+bool AnimationMixer::is_batch_evaluation_enabled() const {
+	return batch_evaluation;
+}
+
+void AnimationMixer::set_lod_enabled(bool p_enabled) {
+	lod_enabled = p_enabled;
+	lod_delta = 0.0;
+	lod_skipped_frames = 0;
+	lod_pose_valid = false;
+}
+
+bool AnimationMixer::is_lod_enabled() const {
+	return lod_enabled;
+}
+
+void AnimationMixer::set_lod_distances(const PackedFloat32Array &p_distances) {
+	lod_distances = p_distances;
+	lod_distances.sort();
+}
+
+PackedFloat32Array AnimationMixer::get_lod_distances() const {
+	return lod_distances;
+}
+
+void AnimationMixer::set_lod_offscreen_interval(int p_interval) {
+	ERR_FAIL_COND_MSG(p_interval < 1, "LOD offscreen interval must be at least 1.");
+	lod_offscreen_interval = p_interval;
+}
+
+int AnimationMixer::get_lod_offscreen_interval() const {
+	return lod_offscreen_interval;
+}
+
+void AnimationMixer::set_lod_interpolation_enabled(bool p_enabled) {
+	lod_interpolation = p_enabled;
+}
+
+bool AnimationMixer::is_lod_interpolation_enabled() const {
+	return lod_interpolation;
+}
+
+void AnimationMixer::set_lod_visibility_notifier(const NodePath &p_path) {
+	lod_visibility_notifier = p_path;
+}
+
+NodePath AnimationMixer::get_lod_visibility_notifier() const {
+	return lod_visibility_notifier;
+}
+
 void AnimationMixer::set_callback_mode_process(AnimationCallbackModeProcess p_mode) {
 	if (callback_mode_process == p_mode) {
 		return;
@@ -561,6 +618,12 @@ void AnimationMixer::_clear_caches() {
 	track_cache.clear();
 	cache_valid = false;
 	capture_cache.clear();
+	if (batch_state != BATCH_STATE_NONE) {
+		// The pending result refers to the deleted caches, drop it.
+		clear_animation_instances();
+		batch_state = BATCH_STATE_NONE;
+	}
+	lod_pose_valid = false;
 
 	emit_signal(SNAME("caches_cleared"));
 }
@@ -926,19 +989,249 @@ bool AnimationMixer::_update_caches() {
 /* -- Blending processor ---------------------- */
 /* -------------------------------------------- */
 
+LocalVector<ObjectID> AnimationMixer::batch_queue;
+
 void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
+	_batch_finish(); // A pending batch result must not be blended with this one.
 	_blend_init();
 	if (_blend_pre_process(p_delta, track_count, track_map)) {
 		_blend_capture(p_delta);
 		_blend_calc_total_weight();
 		_blend_process(p_delta, p_update_only);
 		_blend_apply();
+		if (lod_interpolation_pending) {
+			_lod_apply_interpolation(0.0); // Start from the previous pose, see _process_internal().
+		}
 		_blend_post_process();
 		emit_signal(SNAME("mixer_applied"));
 	};
+	lod_interpolation_pending = false;
 	clear_animation_instances();
 }
 
+void AnimationMixer::_process_internal(double p_delta) {
+	if (lod_enabled) {
+		lod_delta += p_delta;
+		if (lod_pose_valid && ++lod_skipped_frames < lod_update_interval) {
+			// Nothing moved since the last update.
+			root_motion_position = Vector3(0, 0, 0);
+			root_motion_rotation = Quaternion(0, 0, 0, 1);
+			root_motion_scale = Vector3(0, 0, 0);
+			if (lod_interpolation && lod_update_interval > 1) {
+				_lod_apply_interpolation((real_t)lod_skipped_frames / lod_update_interval);
+			}
+			return;
+		}
+
+		int interval = _get_lod_interval();
+		// With interpolation, poses lag one interval behind: the new result is reached when the next update happens.
+		lod_interpolation_pending = lod_interpolation && lod_pose_valid && interval > 1;
+		if (lod_interpolation_pending) {
+			_lod_store_interpolation();
+		}
+		lod_update_interval = interval;
+		if (!lod_pose_valid) {
+			// Spread the updates of mixers starting at the same time over the frames of the interval.
+			lod_update_interval += (uint64_t)get_instance_id() % (uint64_t)interval;
+		}
+		lod_pose_valid = true;
+		lod_skipped_frames = 0;
+		p_delta = lod_delta;
+		lod_delta = 0.0;
+	}
+
+	if (batch_evaluation) {
+		_process_animation_batched(p_delta);
+	} else {
+		_process_animation(p_delta);
+	}
+}
+
+int AnimationMixer::_get_lod_interval() const {
+#ifndef _3D_DISABLED
+	if (!lod_visibility_notifier.is_empty()) {
+		const VisibleOnScreenNotifier3D *notifier = Object::cast_to<VisibleOnScreenNotifier3D>(get_node_or_null(lod_visibility_notifier));
+		if (notifier && !notifier->is_on_screen()) {
+			return lod_offscreen_interval;
+		}
+	}
+
+	const Node3D *root_3d = Object::cast_to<Node3D>(get_node_or_null(root_node));
+	const Camera3D *camera = get_viewport() ? get_viewport()->get_camera_3d() : nullptr;
+	if (!root_3d || !camera) {
+		return 1;
+	}
+
+	// The interval doubles beyond each distance.
+	real_t distance = camera->get_global_position().distance_to(root_3d->get_global_position());
+	int level = 0;
+	while (level < lod_distances.size() && level < 16 && distance >= lod_distances[level]) {
+		level++;
+	}
+	return 1 << level;
+#else
+	return 1;
+#endif // _3D_DISABLED
+}
+
+void AnimationMixer::_lod_store_interpolation() {
+#ifndef _3D_DISABLED
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		if (K.value->type == Animation::TYPE_POSITION_3D) {
+			TrackCacheTransform *t = static_cast<TrackCacheTransform *>(K.value);
+			t->lod_from_loc = t->loc;
+			t->lod_from_rot = t->rot;
+			t->lod_from_scale = t->scale;
+		} else if (K.value->type == Animation::TYPE_BLEND_SHAPE) {
+			TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(K.value);
+			t->lod_from_value = t->value;
+		}
+	}
+#endif // _3D_DISABLED
+}
+
+void AnimationMixer::_lod_apply_interpolation(real_t p_weight) {
+#ifndef _3D_DISABLED
+	// Only transforms and blend shapes are interpolated, the other tracks keep the values of the last update.
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		TrackCache *track = K.value;
+		if (!deterministic && Math::is_zero_approx(track->total_weight)) {
+			continue;
+		}
+		if (track->type == Animation::TYPE_POSITION_3D) {
+			TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
+			if (t->root_motion) {
+				continue;
+			}
+			Vector3 loc = t->lod_from_loc.lerp(t->loc, p_weight);
+			Quaternion rot = t->lod_from_rot.is_normalized() && t->rot.is_normalized() ? t->lod_from_rot.slerp(t->rot, p_weight) : t->rot;
+			Vector3 scale = t->lod_from_scale.lerp(t->scale, p_weight);
+			if (t->skeleton_id.is_valid() && t->bone_idx >= 0) {
+				Skeleton3D *t_skeleton = Object::cast_to<Skeleton3D>(ObjectDB::get_instance(t->skeleton_id));
+				if (!t_skeleton) {
+					continue;
+				}
+				if (t->loc_used) {
+					t_skeleton->set_bone_pose_position(t->bone_idx, loc);
+				}
+				if (t->rot_used) {
+					t_skeleton->set_bone_pose_rotation(t->bone_idx, rot);
+				}
+				if (t->scale_used) {
+					t_skeleton->set_bone_pose_scale(t->bone_idx, scale);
+				}
+			} else if (!t->skeleton_id.is_valid()) {
+				Node3D *t_node_3d = Object::cast_to<Node3D>(ObjectDB::get_instance(t->object_id));
+				if (!t_node_3d) {
+					continue;
+				}
+				if (t->loc_used) {
+					t_node_3d->set_position(loc);
+				}
+				if (t->rot_used) {
+					t_node_3d->set_rotation(rot.get_euler());
+				}
+				if (t->scale_used) {
+					t_node_3d->set_scale(scale);
+				}
+			}
+		} else if (track->type == Animation::TYPE_BLEND_SHAPE) {
+			TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
+			MeshInstance3D *t_mesh_3d = Object::cast_to<MeshInstance3D>(ObjectDB::get_instance(t->object_id));
+			if (t_mesh_3d) {
+				t_mesh_3d->set_blend_shape_value(t->shape_index, Math::lerp(t->lod_from_value, t->value, (float)p_weight));
+			}
+		}
+	}
+#endif // _3D_DISABLED
+}
+
+void AnimationMixer::_process_animation_batched(double p_delta) {
+	// Scripted key post-processing and nodes processed by a sub-thread group can't take part in the batch.
+	if (!Thread::is_main_thread() || GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value)) {
+		_process_animation(p_delta);
+		return;
+	}
+
+	// The blend tree/playback is evaluated right away, as AnimationNode resources hold evaluation state and are shared between mixers.
+	_batch_finish();
+	_blend_init();
+	if (!_blend_pre_process(p_delta, track_count, track_map)) {
+		lod_interpolation_pending = false;
+		clear_animation_instances();
+		return;
+	}
+
+	batch_delta = p_delta;
+	batch_state = BATCH_STATE_QUEUED;
+	if (batch_queue.is_empty()) {
+		callable_mp_static(&AnimationMixer::_flush_batch).call_deferred();
+	}
+	batch_queue.push_back(get_instance_id());
+}
+
+void AnimationMixer::_batch_sample() {
+	_blend_capture(batch_delta);
+	_blend_calc_total_weight();
+	_blend_process(batch_delta, false, BLEND_PROCESS_SAMPLE);
+	batch_state = BATCH_STATE_SAMPLED;
+}
+
+void AnimationMixer::_batch_commit() {
+	batch_state = BATCH_STATE_NONE;
+	_blend_process(batch_delta, false, BLEND_PROCESS_EVENTS);
+	_blend_apply();
+	if (lod_interpolation_pending) {
+		_lod_apply_interpolation(0.0);
+	}
+	_blend_post_process();
+	emit_signal(SNAME("mixer_applied"));
+	lod_interpolation_pending = false;
+	clear_animation_instances();
+}
+
+void AnimationMixer::_batch_finish() {
+	if (batch_state == BATCH_STATE_QUEUED) {
+		_batch_sample();
+	}
+	if (batch_state == BATCH_STATE_SAMPLED) {
+		_batch_commit();
+	}
+}
+
+void AnimationMixer::_batch_sample_task(void *p_userdata, uint32_t p_index) {
+	AnimationMixer **mixers = (AnimationMixer **)p_userdata;
+	mixers[p_index]->_batch_sample();
+}
+
+void AnimationMixer::_flush_batch() {
+	LocalVector<ObjectID> ids;
+	LocalVector<AnimationMixer *> mixers;
+	for (const ObjectID &id : batch_queue) {
+		AnimationMixer *mixer = Object::cast_to<AnimationMixer>(ObjectDB::get_instance(id));
+		if (mixer && mixer->batch_state == BATCH_STATE_QUEUED) {
+			ids.push_back(id);
+			mixers.push_back(mixer);
+		}
+	}
+	batch_queue.reset();
+
+	if (mixers.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_batch_sample_task, mixers.ptr(), mixers.size(), -1, true, SNAME("AnimationMixerBatchSample"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (mixers.size() == 1) {
+		mixers[0]->_batch_sample();
+	}
+
+	// Commit in queue order, so the result matches serial processing.
+	for (uint32_t i = 0; i < mixers.size(); i++) {
+		// Method tracks of a mixer may free or process the following ones.
+		if (ObjectDB::get_instance(ids[i]) && mixers[i]->batch_state == BATCH_STATE_SAMPLED) {
+			mixers[i]->_batch_commit();
+		}
+	}
+}
+
 Variant AnimationMixer::post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, ObjectID p_object_id, int p_object_sub_idx) {
 	Variant res;
 	if (GDVIRTUAL_CALL(_post_process_key_value, p_anim, p_track, p_value, p_object_id, p_object_sub_idx, res)) {
@@ -1095,7 +1388,7 @@ void AnimationMixer::_blend_calc_total_weight() {
 	}
 }
 
-void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
+void AnimationMixer::_blend_process(double p_delta, bool p_update_only, BlendProcessPass p_pass) {
 	// Apply value/transform/blend/bezier blends to track caches and execute method/audio/animation tracks.
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
@@ -1112,6 +1405,11 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 		bool backward = signbit(delta); // This flag is used by the root motion calculates or detecting the end of audio stream.
 #ifndef _3D_DISABLED
 		bool calc_root = !seeked || is_external_seeking;
+		// Baked animations sample all their transform tracks at once, up-front.
+		bool use_baked = p_pass != BLEND_PROCESS_EVENTS && a->has_baked_transforms();
+		if (use_baked) {
+			a->sample_baked_transforms(time, baked_sample);
+		}
 #endif // _3D_DISABLED
 
 		for (int i = 0; i < a->get_track_count(); i++) {
@@ -1119,12 +1417,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				continue;
 			}
 			Animation::TypeHash thash = a->track_get_type_hash(i);
-			if (!track_cache.has(thash)) {
+			TrackCache **track_ptr = track_cache.getptr(thash);
+			if (!track_ptr) {
 				continue; // No path, but avoid error spamming.
 			}
-			TrackCache *track = track_cache[thash];
-			ERR_CONTINUE(!track_map.has(track->path));
-			int blend_idx = track_map[track->path];
+			TrackCache *track = *track_ptr;
+			const int *blend_idx_ptr = track_map.getptr(track->path);
+			ERR_CONTINUE(!blend_idx_ptr);
+			int blend_idx = *blend_idx_ptr;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
 			real_t blend = blend_idx < track_weights.size() ? track_weights[blend_idx] * weight : weight;
 			if (!deterministic) {
@@ -1136,6 +1436,18 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				blend = blend / track->total_weight;
 			}
 			Animation::TrackType ttype = a->track_get_type(i);
+			if (p_pass != BLEND_PROCESS_ALL) {
+				// Tracks which set values or call into other objects directly are left to the main thread.
+				bool is_event = ttype == Animation::TYPE_METHOD || ttype == Animation::TYPE_AUDIO || ttype == Animation::TYPE_ANIMATION;
+				if (ttype == Animation::TYPE_VALUE) {
+					bool is_discrete = a->value_track_get_update_mode(i) == Animation::UPDATE_DISCRETE;
+					bool force_continuous = callback_mode_discrete == ANIMATION_CALLBACK_MODE_DISCRETE_FORCE_CONTINUOUS;
+					is_event = !static_cast<TrackCacheValue *>(track)->is_variant_interpolatable || (is_discrete && !force_continuous);
+				}
+				if (is_event != (p_pass == BLEND_PROCESS_EVENTS)) {
+					continue;
+				}
+			}
 			track->root_motion = root_motion_track == a->track_get_path(i);
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
@@ -1217,9 +1529,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
-						if (err != OK) {
-							continue;
+						int32_t baked_slot = use_baked ? a->baked_transforms_get_slot(i) : -1;
+						if (baked_slot >= 0) {
+							loc = a->baked_transforms_get_position(baked_sample, baked_slot);
+						} else {
+							Error err = a->try_position_track_interpolate(i, time, &loc);
+							if (err != OK) {
+								continue;
+							}
 						}
 						loc = post_process_key_value(a, i, loc, t->object_id, t->bone_idx);
 						t->loc += (loc - t->init_loc) * blend;
@@ -1304,9 +1621,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
-						if (err != OK) {
-							continue;
+						int32_t baked_slot = use_baked ? a->baked_transforms_get_slot(i) : -1;
+						if (baked_slot >= 0) {
+							rot = a->baked_transforms_get_rotation(baked_sample, baked_slot);
+						} else {
+							Error err = a->try_rotation_track_interpolate(i, time, &rot);
+							if (err != OK) {
+								continue;
+							}
 						}
 						rot = post_process_key_value(a, i, rot, t->object_id, t->bone_idx);
 						t->rot = (t->rot * Quaternion().slerp(t->init_rot.inverse() * rot, blend)).normalized();
@@ -1392,9 +1714,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
-						if (err != OK) {
-							continue;
+						int32_t baked_slot = use_baked ? a->baked_transforms_get_slot(i) : -1;
+						if (baked_slot >= 0) {
+							scale = a->baked_transforms_get_scale(baked_sample, baked_slot);
+						} else {
+							Error err = a->try_scale_track_interpolate(i, time, &scale);
+							if (err != OK) {
+								continue;
+							}
 						}
 						scale = post_process_key_value(a, i, scale, t->object_id, t->bone_idx);
 						t->scale += (scale - t->init_scale) * blend;
@@ -2150,13 +2477,13 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				_process_internal(get_process_delta_time());
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				_process_internal(get_physics_process_delta_time());
 			}
 		} break;
 
@@ -2208,6 +2535,25 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_deterministic", "deterministic"), &AnimationMixer::set_deterministic);
 	ClassDB::bind_method(D_METHOD("is_deterministic"), &AnimationMixer::is_deterministic);
 
+	ClassDB::bind_method(D_METHOD("set_batch_evaluation_enabled", "enabled"), &AnimationMixer::set_batch_evaluation_enabled);
+	ClassDB::bind_method(D_METHOD("is_batch_evaluation_enabled"), &AnimationMixer::is_batch_evaluation_enabled);
+
+	/* ---- Update LOD ---- */
+	ClassDB::bind_method(D_METHOD("set_lod_enabled", "enabled"), &AnimationMixer::set_lod_enabled);
+	ClassDB::bind_method(D_METHOD("is_lod_enabled"), &AnimationMixer::is_lod_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_lod_distances", "distances"), &AnimationMixer::set_lod_distances);
+	ClassDB::bind_method(D_METHOD("get_lod_distances"), &AnimationMixer::get_lod_distances);
+
+	ClassDB::bind_method(D_METHOD("set_lod_offscreen_interval", "interval"), &AnimationMixer::set_lod_offscreen_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_offscreen_interval"), &AnimationMixer::get_lod_offscreen_interval);
+
+	ClassDB::bind_method(D_METHOD("set_lod_interpolation_enabled", "enabled"), &AnimationMixer::set_lod_interpolation_enabled);
+	ClassDB::bind_method(D_METHOD("is_lod_interpolation_enabled"), &AnimationMixer::is_lod_interpolation_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_lod_visibility_notifier", "path"), &AnimationMixer::set_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("get_lod_visibility_notifier"), &AnimationMixer::get_lod_visibility_notifier);
+
 	ClassDB::bind_method(D_METHOD("set_root_node", "path"), &AnimationMixer::set_root_node);
 	ClassDB::bind_method(D_METHOD("get_root_node"), &AnimationMixer::get_root_node);
 
@@ -2248,12 +2594,20 @@ void AnimationMixer::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "deterministic"), "set_deterministic", "is_deterministic");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "batch_evaluation"), "set_batch_evaluation_enabled", "is_batch_evaluation_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "reset_on_save", PROPERTY_HINT_NONE, ""), "set_reset_on_save_enabled", "is_reset_on_save_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_node"), "set_root_node", "get_root_node");
 
 	ADD_GROUP("Root Motion", "root_motion_");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_motion_track"), "set_root_motion_track", "get_root_motion_track");
 
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_enabled"), "set_lod_enabled", "is_lod_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_FLOAT32_ARRAY, "lod_distances", PROPERTY_HINT_NONE, "suffix:m"), "set_lod_distances", "get_lod_distances");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_offscreen_interval", PROPERTY_HINT_RANGE, "1,64,1"), "set_lod_offscreen_interval", "get_lod_offscreen_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_interpolation"), "set_lod_interpolation_enabled", "is_lod_interpolation_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "lod_visibility_notifier", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "VisibleOnScreenNotifier3D"), "set_lod_visibility_notifier", "get_lod_visibility_notifier");
+
 	ADD_GROUP("Audio", "audio_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "audio_max_polyphony", PROPERTY_HINT_RANGE, "1,127,1"), "set_audio_max_polyphony", "get_audio_max_polyphony");
 
@@ -2287,6 +2641,9 @@ void AnimationMixer::_bind_methods() {
 
 AnimationMixer::AnimationMixer() {
 	root_node = SceneStringNames::get_singleton()->path_pp;
+	lod_distances.push_back(25.0);
+	lod_distances.push_back(50.0);
+	lod_distances.push_back(100.0);
 }
 
 AnimationMixer::~AnimationMixer() {
@@ -173,6 +173,10 @@ protected:
 		Vector3 loc;
 		Quaternion rot;
 		Vector3 scale;
+		// Pose interpolated from while the mixer skips updates because of its LOD.
+		Vector3 lod_from_loc;
+		Quaternion lod_from_rot;
+		Vector3 lod_from_scale = Vector3(1, 1, 1);
 
 		TrackCacheTransform(const TrackCacheTransform &p_other) :
 				TrackCache(p_other),
@@ -188,7 +192,10 @@ protected:
 				init_scale(p_other.init_scale),
 				loc(p_other.loc),
 				rot(p_other.rot),
-				scale(p_other.scale) {
+				scale(p_other.scale),
+				lod_from_loc(p_other.lod_from_loc),
+				lod_from_rot(p_other.lod_from_rot),
+				lod_from_scale(p_other.lod_from_scale) {
 		}
 
 		TrackCacheTransform() {
@@ -206,12 +213,14 @@ protected:
 	struct TrackCacheBlendShape : public TrackCache {
 		float init_value = 0;
 		float value = 0;
+		float lod_from_value = 0;
 		int shape_index = -1;
 
 		TrackCacheBlendShape(const TrackCacheBlendShape &p_other) :
 				TrackCache(p_other),
 				init_value(p_other.init_value),
 				value(p_other.value),
+				lod_from_value(p_other.lod_from_value),
 				shape_index(p_other.shape_index) {}
 
 		TrackCacheBlendShape() { type = Animation::TYPE_BLEND_SHAPE; }
@@ -318,6 +327,47 @@ protected:
 	HashMap<NodePath, int> track_map;
 	int track_count = 0;
 	bool deterministic = false;
+	LocalVector<float> baked_sample; // Scratch buffer for Animation::sample_baked_transforms().
+
+	/* ---- Batch evaluation ---- */
+	enum BlendProcessPass {
+		BLEND_PROCESS_ALL,
+		BLEND_PROCESS_SAMPLE, // Value/transform/blend/bezier blends, safe to run on a worker thread.
+		BLEND_PROCESS_EVENTS, // Discrete value/method/audio/animation tracks, must run on the main thread.
+	};
+	enum BatchState {
+		BATCH_STATE_NONE,
+		BATCH_STATE_QUEUED,
+		BATCH_STATE_SAMPLED,
+	};
+	bool batch_evaluation = false;
+	BatchState batch_state = BATCH_STATE_NONE;
+	double batch_delta = 0.0;
+	static LocalVector<ObjectID> batch_queue;
+
+	void _process_animation_batched(double p_delta);
+	void _process_internal(double p_delta);
+	void _batch_sample();
+	void _batch_commit();
+	void _batch_finish();
+	static void _batch_sample_task(void *p_userdata, uint32_t p_index);
+	static void _flush_batch();
+
+	/* ---- Update LOD ---- */
+	bool lod_enabled = false;
+	PackedFloat32Array lod_distances;
+	int lod_offscreen_interval = 8;
+	bool lod_interpolation = true;
+	NodePath lod_visibility_notifier;
+	double lod_delta = 0.0; // Accumulated over skipped frames.
+	int lod_skipped_frames = 0;
+	int lod_update_interval = 1;
+	bool lod_pose_valid = false; // Whether the track caches hold a pose to interpolate from.
+	bool lod_interpolation_pending = false;
+
+	int _get_lod_interval() const;
+	void _lod_store_interpolation();
+	void _lod_apply_interpolation(real_t p_weight);
 
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	NodePath root_motion_track;
@@ -358,7 +408,7 @@ protected:
 	virtual bool _blend_pre_process(double p_delta, int p_track_count, const HashMap<NodePath, int> &p_track_map);
 	virtual void _blend_capture(double p_delta);
 	void _blend_calc_total_weight(); // For undeterministic blending.
-	void _blend_process(double p_delta, bool p_update_only = false);
+	void _blend_process(double p_delta, bool p_update_only = false, BlendProcessPass p_pass = BLEND_PROCESS_ALL);
 	void _blend_apply();
 	virtual void _blend_post_process();
 	void _call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
@@ -413,6 +463,24 @@ public:
 	void set_deterministic(bool p_deterministic);
 	bool is_deterministic() const;
 
+	void set_batch_evaluation_enabled(bool p_enabled);
+	bool is_batch_evaluation_enabled() const;
+
+	void set_lod_enabled(bool p_enabled);
+	bool is_lod_enabled() const;
+
+	void set_lod_distances(const PackedFloat32Array &p_distances);
+	PackedFloat32Array get_lod_distances() const;
+
+	void set_lod_offscreen_interval(int p_interval);
+	int get_lod_offscreen_interval() const;
+
+	void set_lod_interpolation_enabled(bool p_enabled);
+	bool is_lod_interpolation_enabled() const;
+
+	void set_lod_visibility_notifier(const NodePath &p_path);
+	NodePath get_lod_visibility_notifier() const;
+
 	void set_root_node(const NodePath &p_path);
 	NodePath get_root_node() const;
 
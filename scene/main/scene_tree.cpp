@@ -179,14 +179,30 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	xform_batching = true;
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
 		SelfList<Node> *nx = n->next();
 		xform_change_list.remove(n);
+		xform_change_epoch.increment();
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+
+	xform_batching = false;
+	_flush_instance_transforms();
+}
+
+void SceneTree::_flush_instance_transforms() {
+	if (xform_batch_instances.is_empty()) {
+		return;
+	}
+
+	RenderingServer::get_singleton()->instance_set_transforms(xform_batch_instances, xform_batch_transforms);
+	xform_batch_instances.clear();
+	xform_batch_transforms.clear();
 }
 
 void SceneTree::_flush_ugc() {
@@ -231,8 +231,17 @@ private:
 	friend class CanvasItem;
 	friend class Node3D;
 	friend class Viewport;
+	friend class VisualInstance3D;
 
 	SelfList<Node>::List xform_change_list;
+	// Bumped whenever a node may leave xform_change_list or become eligible for it, invalidating the propagation marks of Node3D.
+	SafeNumeric<uint32_t> xform_change_epoch{ 1 };
+
+	// Visual instance transforms changed while flushing transform notifications, sent to the RenderingServer at once.
+	bool xform_batching = false;
+	Vector<RID> xform_batch_instances;
+	Vector<Transform3D> xform_batch_transforms;
+	void _flush_instance_transforms();
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -38,6 +38,9 @@
 bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 	String prop_name = p_name;
 
+	// Stored properties are either track data or the compression, both of which invalidate baked transforms.
+	clear_baked_transforms();
+
 	if (p_name == SNAME("_compression")) {
 		ERR_FAIL_COND_V(tracks.size() > 0, false); //can only set compression if no tracks exist
 		Dictionary comp = p_value;
@@ -904,7 +907,7 @@ int Animation::add_track(TrackType p_type, int p_at_pos) {
 			ERR_PRINT("Unknown track type");
 		}
 	}
-	emit_changed();
+	_changed();
 	return p_at_pos;
 }
 
@@ -966,7 +969,7 @@ void Animation::remove_track(int p_track) {
 
 	memdelete(t);
 	tracks.remove_at(p_track);
-	emit_changed();
+	_changed();
 	_check_capture_included();
 }
 
@@ -1004,7 +1007,7 @@ void Animation::track_set_path(int p_track, const NodePath &p_path) {
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	tracks[p_track]->path = p_path;
 	_track_update_hash(p_track);
-	emit_changed();
+	_changed();
 }
 
 NodePath Animation::track_get_path(int p_track) const {
@@ -1045,7 +1048,7 @@ Animation::TypeHash Animation::track_get_type_hash(int p_track) const {
 void Animation::track_set_interpolation_type(int p_track, InterpolationType p_interp) {
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	tracks[p_track]->interpolation = p_interp;
-	emit_changed();
+	_changed();
 }
 
 Animation::InterpolationType Animation::track_get_interpolation_type(int p_track) const {
@@ -1056,7 +1059,7 @@ Animation::InterpolationType Animation::track_get_interpolation_type(int p_track
 void Animation::track_set_interpolation_loop_wrap(int p_track, bool p_enable) {
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	tracks[p_track]->loop_wrap = p_enable;
-	emit_changed();
+	_changed();
 }
 
 bool Animation::track_get_interpolation_loop_wrap(int p_track) const {
@@ -1109,7 +1112,7 @@ int Animation::position_track_insert_key(int p_track, double p_time, const Vecto
 	tkey.value = p_position;
 
 	int ret = _insert(p_time, tt->positions, tkey);
-	emit_changed();
+	_changed();
 	return ret;
 }
 
@@ -1189,7 +1192,7 @@ int Animation::rotation_track_insert_key(int p_track, double p_time, const Quate
 	tkey.value = p_rotation;
 
 	int ret = _insert(p_time, rt->rotations, tkey);
-	emit_changed();
+	_changed();
 	return ret;
 }
 
@@ -1269,7 +1272,7 @@ int Animation::scale_track_insert_key(int p_track, double p_time, const Vector3
 	tkey.value = p_scale;
 
 	int ret = _insert(p_time, st->scales, tkey);
-	emit_changed();
+	_changed();
 	return ret;
 }
 
@@ -1349,7 +1352,7 @@ int Animation::blend_shape_track_insert_key(int p_track, double p_time, float p_
 	tkey.value = p_blend_shape;
 
 	int ret = _insert(p_time, st->blend_shapes, tkey);
-	emit_changed();
+	_changed();
 	return ret;
 }
 
@@ -1494,7 +1497,7 @@ void Animation::track_remove_key(int p_track, int p_idx) {
 		} break;
 	}
 
-	emit_changed();
+	_changed();
 }
 
 int Animation::track_find_key(int p_track, double p_time, FindMode p_find_mode, bool p_limit) const {
@@ -1787,7 +1790,7 @@ int Animation::track_insert_key(int p_track, double p_time, const Variant &p_key
 		} break;
 	}
 
-	emit_changed();
+	_changed();
 
 	return ret;
 }
@@ -2019,6 +2022,7 @@ double Animation::track_get_key_time(int p_track, int p_key_idx) const {
 void Animation::track_set_key_time(int p_track, int p_key_idx, double p_time) {
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
+	clear_baked_transforms();
 
 	switch (t->type) {
 		case TYPE_POSITION_3D: {
@@ -2300,7 +2304,7 @@ void Animation::track_set_key_value(int p_track, int p_key_idx, const Variant &p
 		} break;
 	}
 
-	emit_changed();
+	_changed();
 }
 
 void Animation::track_set_key_transition(int p_track, int p_key_idx, real_t p_transition) {
@@ -2351,7 +2355,7 @@ void Animation::track_set_key_transition(int p_track, int p_key_idx, real_t p_tr
 		} break;
 	}
 
-	emit_changed();
+	_changed();
 }
 
 template <typename K>
@@ -2706,7 +2710,7 @@ void Animation::value_track_set_update_mode(int p_track, UpdateMode p_mode) {
 	vt->update_mode = p_mode;
 
 	_check_capture_included();
-	emit_changed();
+	_changed();
 }
 
 Animation::UpdateMode Animation::value_track_get_update_mode(int p_track) const {
@@ -3211,7 +3215,7 @@ int Animation::bezier_track_insert_key(int p_track, double p_time, real_t p_valu
 
 	int key = _insert(p_time, bt->values, k);
 
-	emit_changed();
+	_changed();
 
 	return key;
 }
@@ -3227,7 +3231,7 @@ void Animation::bezier_track_set_key_value(int p_track, int p_index, real_t p_va
 
 	bt->values.write[p_index].value.value = p_value;
 
-	emit_changed();
+	_changed();
 }
 
 void Animation::bezier_track_set_key_in_handle(int p_track, int p_index, const Vector2 &p_handle, real_t p_balanced_value_time_ratio) {
@@ -3262,7 +3266,7 @@ void Animation::bezier_track_set_key_in_handle(int p_track, int p_index, const V
 	}
 #endif // TOOLS_ENABLED
 
-	emit_changed();
+	_changed();
 }
 
 void Animation::bezier_track_set_key_out_handle(int p_track, int p_index, const Vector2 &p_handle, real_t p_balanced_value_time_ratio) {
@@ -3297,7 +3301,7 @@ void Animation::bezier_track_set_key_out_handle(int p_track, int p_index, const
 	}
 #endif // TOOLS_ENABLED
 
-	emit_changed();
+	_changed();
 }
 
 real_t Animation::bezier_track_get_key_value(int p_track, int p_index) const {
@@ -3423,7 +3427,7 @@ void Animation::bezier_track_set_key_handle_mode(int p_track, int p_index, Handl
 		} break;
 	}
 
-	emit_changed();
+	_changed();
 }
 
 Animation::HandleMode Animation::bezier_track_get_key_handle_mode(int p_track, int p_index) const {
@@ -3525,7 +3529,7 @@ int Animation::audio_track_insert_key(int p_track, double p_time, const Ref<Reso
 
 	int key = _insert(p_time, at->values, k);
 
-	emit_changed();
+	_changed();
 
 	return key;
 }
@@ -3541,7 +3545,7 @@ void Animation::audio_track_set_key_stream(int p_track, int p_key, const Ref<Res
 
 	at->values.write[p_key].value.stream = p_stream;
 
-	emit_changed();
+	_changed();
 }
 
 void Animation::audio_track_set_key_start_offset(int p_track, int p_key, real_t p_offset) {
@@ -3559,7 +3563,7 @@ void Animation::audio_track_set_key_start_offset(int p_track, int p_key, real_t
 
 	at->values.write[p_key].value.start_offset = p_offset;
 
-	emit_changed();
+	_changed();
 }
 
 void Animation::audio_track_set_key_end_offset(int p_track, int p_key, real_t p_offset) {
@@ -3577,7 +3581,7 @@ void Animation::audio_track_set_key_end_offset(int p_track, int p_key, real_t p_
 
 	at->values.write[p_key].value.end_offset = p_offset;
 
-	emit_changed();
+	_changed();
 }
 
 Ref<Resource> Animation::audio_track_get_key_stream(int p_track, int p_key) const {
@@ -3624,7 +3628,7 @@ void Animation::audio_track_set_use_blend(int p_track, bool p_enable) {
 	AudioTrack *at = static_cast<AudioTrack *>(t);
 
 	at->use_blend = p_enable;
-	emit_changed();
+	_changed();
 }
 
 bool Animation::audio_track_is_use_blend(int p_track) const {
@@ -3652,7 +3656,7 @@ int Animation::animation_track_insert_key(int p_track, double p_time, const Stri
 
 	int key = _insert(p_time, at->values, k);
 
-	emit_changed();
+	_changed();
 
 	return key;
 }
@@ -3668,7 +3672,7 @@ void Animation::animation_track_set_key_animation(int p_track, int p_key, const
 
 	at->values.write[p_key].value = p_animation;
 
-	emit_changed();
+	_changed();
 }
 
 StringName Animation::animation_track_get_key_animation(int p_track, int p_key) const {
@@ -3688,7 +3692,7 @@ void Animation::set_length(real_t p_length) {
 		p_length = ANIM_MIN_LENGTH;
 	}
 	length = p_length;
-	emit_changed();
+	_changed();
 }
 
 real_t Animation::get_length() const {
@@ -3697,7 +3701,7 @@ real_t Animation::get_length() const {
 
 void Animation::set_loop_mode(Animation::LoopMode p_loop_mode) {
 	loop_mode = p_loop_mode;
-	emit_changed();
+	_changed();
 }
 
 Animation::LoopMode Animation::get_loop_mode() const {
@@ -3717,7 +3721,7 @@ bool Animation::track_is_imported(int p_track) const {
 void Animation::track_set_enabled(int p_track, bool p_enabled) {
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	tracks[p_track]->enabled = p_enabled;
-	emit_changed();
+	_changed();
 }
 
 bool Animation::track_is_enabled(int p_track) const {
@@ -3730,7 +3734,7 @@ void Animation::track_move_up(int p_track) {
 		SWAP(tracks.write[p_track], tracks.write[p_track + 1]);
 	}
 
-	emit_changed();
+	_changed();
 }
 
 void Animation::track_move_down(int p_track) {
@@ -3738,7 +3742,7 @@ void Animation::track_move_down(int p_track) {
 		SWAP(tracks.write[p_track], tracks.write[p_track - 1]);
 	}
 
-	emit_changed();
+	_changed();
 }
 
 void Animation::track_move_to(int p_track, int p_to_index) {
@@ -3753,7 +3757,7 @@ void Animation::track_move_to(int p_track, int p_to_index) {
 	// Take into account that the position of the tracks that come after the one removed will change.
 	tracks.insert(p_to_index > p_track ? p_to_index - 1 : p_to_index, track);
 
-	emit_changed();
+	_changed();
 }
 
 void Animation::track_swap(int p_track, int p_with_track) {
@@ -3764,12 +3768,12 @@ void Animation::track_swap(int p_track, int p_with_track) {
 	}
 	SWAP(tracks.write[p_track], tracks.write[p_with_track]);
 
-	emit_changed();
+	_changed();
 }
 
 void Animation::set_step(real_t p_step) {
 	step = p_step;
-	emit_changed();
+	_changed();
 }
 
 real_t Animation::get_step() const {
@@ -3895,6 +3899,10 @@ void Animation::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("compress", "page_size", "fps", "split_tolerance"), &Animation::compress, DEFVAL(8192), DEFVAL(120), DEFVAL(4.0));
 
+	ClassDB::bind_method(D_METHOD("bake_transforms", "fps"), &Animation::bake_transforms, DEFVAL(30.0));
+	ClassDB::bind_method(D_METHOD("clear_baked_transforms"), &Animation::clear_baked_transforms);
+	ClassDB::bind_method(D_METHOD("has_baked_transforms"), &Animation::has_baked_transforms);
+
 	ClassDB::bind_method(D_METHOD("_set_capture_included", "capture_included"), &Animation::set_capture_included);
 	ClassDB::bind_method(D_METHOD("is_capture_included"), &Animation::is_capture_included);
 
@@ -3947,9 +3955,147 @@ void Animation::clear() {
 	compression.bounds.clear();
 	compression.pages.clear();
 	compression.fps = 120;
+	_changed();
+}
+
+void Animation::_changed() {
+	clear_baked_transforms();
 	emit_changed();
 }
 
+void Animation::bake_transforms(double p_fps) {
+	ERR_FAIL_COND_MSG(p_fps <= 0.0, "Baking FPS must be greater than zero.");
+	clear_baked_transforms();
+
+	BakedTransforms &b = baked_transforms;
+	b.track_slots.resize(tracks.size());
+	for (int i = 0; i < tracks.size(); i++) {
+		int32_t slot = -1;
+		// Baked frames are blended linearly, so tracks using other interpolation modes are sampled as usual.
+		const InterpolationType interp = tracks[i]->interpolation;
+		if (track_get_key_count(i) > 0 && (interp == INTERPOLATION_LINEAR || interp == INTERPOLATION_LINEAR_ANGLE)) {
+			switch (tracks[i]->type) {
+				case TYPE_POSITION_3D: {
+					slot = b.position_count++;
+				} break;
+				case TYPE_ROTATION_3D: {
+					slot = b.rotation_count++;
+				} break;
+				case TYPE_SCALE_3D: {
+					slot = b.scale_count++;
+				} break;
+				default: {
+				}
+			}
+		}
+		b.track_slots[i] = slot;
+	}
+	b.frame_stride = b.position_count * 3 + b.rotation_count * 4 + b.scale_count * 3;
+	if (b.frame_stride == 0) {
+		b.track_slots.clear();
+		return;
+	}
+
+	// Frames land exactly on both ends of the animation.
+	b.frame_count = length > 0 ? MAX(uint32_t(Math::ceil(length * p_fps)), 1u) + 1 : 1;
+	b.step = b.frame_count > 1 ? length / (b.frame_count - 1) : 0.0;
+	b.frames.resize(b.frame_count * b.frame_stride);
+
+	for (uint32_t f = 0; f < b.frame_count; f++) {
+		const double time = f + 1 == b.frame_count ? length : f * b.step;
+		float *frame = b.frames.ptr() + f * b.frame_stride;
+		float *positions = frame;
+		float *rotations = positions + b.position_count * 3;
+		float *scales = rotations + b.rotation_count * 4;
+
+		for (int i = 0; i < tracks.size(); i++) {
+			const int32_t slot = b.track_slots[i];
+			if (slot < 0) {
+				continue;
+			}
+			switch (tracks[i]->type) {
+				case TYPE_POSITION_3D: {
+					Vector3 v;
+					try_position_track_interpolate(i, time, &v);
+					positions[slot] = v.x;
+					positions[b.position_count + slot] = v.y;
+					positions[b.position_count * 2 + slot] = v.z;
+				} break;
+				case TYPE_ROTATION_3D: {
+					Quaternion q;
+					try_rotation_track_interpolate(i, time, &q);
+					if (f > 0) {
+						// Keep consecutive frames in the same hemisphere, so blending them takes the short path.
+						const float *prev = rotations - b.frame_stride;
+						const uint32_t n = b.rotation_count;
+						if (q.x * prev[slot] + q.y * prev[n + slot] + q.z * prev[n * 2 + slot] + q.w * prev[n * 3 + slot] < 0) {
+							q = -q;
+						}
+					}
+					rotations[slot] = q.x;
+					rotations[b.rotation_count + slot] = q.y;
+					rotations[b.rotation_count * 2 + slot] = q.z;
+					rotations[b.rotation_count * 3 + slot] = q.w;
+				} break;
+				case TYPE_SCALE_3D: {
+					Vector3 v;
+					try_scale_track_interpolate(i, time, &v);
+					scales[slot] = v.x;
+					scales[b.scale_count + slot] = v.y;
+					scales[b.scale_count * 2 + slot] = v.z;
+				} break;
+				default: {
+				}
+			}
+		}
+	}
+}
+
+void Animation::clear_baked_transforms() {
+	baked_transforms = BakedTransforms();
+}
+
+bool Animation::has_baked_transforms() const {
+	return baked_transforms.frame_stride > 0;
+}
+
+void Animation::sample_baked_transforms(double p_time, LocalVector<float> &r_sample) const {
+	const BakedTransforms &b = baked_transforms;
+	ERR_FAIL_COND(b.frame_stride == 0);
+
+	r_sample.resize(b.frame_stride);
+	float *out = r_sample.ptr();
+
+	uint32_t from = 0;
+	float c = 0.0;
+	if (b.frame_count > 1) {
+		double frame = CLAMP(p_time / b.step, 0.0, double(b.frame_count - 1));
+		from = MIN(uint32_t(frame), b.frame_count - 2);
+		c = float(frame - from);
+	}
+	const float *a = b.frames.ptr() + from * b.frame_stride;
+	const float *n = b.frame_count > 1 ? a + b.frame_stride : a;
+
+	// Plain loops over contiguous arrays, so the compiler can vectorize them.
+	for (uint32_t i = 0; i < b.frame_stride; i++) {
+		out[i] = a[i] + (n[i] - a[i]) * c;
+	}
+
+	const uint32_t rc = b.rotation_count;
+	float *x = out + b.position_count * 3;
+	float *y = x + rc;
+	float *z = y + rc;
+	float *w = z + rc;
+	for (uint32_t i = 0; i < rc; i++) {
+		const float len_sq = x[i] * x[i] + y[i] * y[i] + z[i] * z[i] + w[i] * w[i];
+		const float inv = len_sq > 0.0f ? 1.0f / Math::sqrt(len_sq) : 0.0f;
+		x[i] *= inv;
+		y[i] *= inv;
+		z[i] *= inv;
+		w[i] = len_sq > 0.0f ? w[i] * inv : 1.0f;
+	}
+}
+
 bool Animation::_float_track_optimize_key(const TKey<float> t0, const TKey<float> t1, const TKey<float> t2, real_t p_allowed_velocity_err, real_t p_allowed_precision_error) {
 	// Remove overlapping keys.
 	if (Math::is_equal_approx(t0.time, t1.time) || Math::is_equal_approx(t1.time, t2.time)) {
@@ -4315,6 +4461,7 @@ void Animation::optimize(real_t p_allowed_velocity_err, real_t p_allowed_angular
 			_value_track_optimize(i, p_allowed_velocity_err, p_allowed_angular_err, precision);
 		}
 	}
+	clear_baked_transforms();
 }
 
 #define print_animc(m_str)
@@ -5029,6 +5176,7 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 			}
 		}
 	}
+	clear_baked_transforms();
 #if 1
 	uint32_t orig_size = 0;
 	for (int i = 0; i < get_track_count(); i++) {
@@ -341,6 +341,27 @@ private:
 		bool enabled = false;
 	} compression;
 
+	/* Baked transforms:
+	 *
+	 * Position, rotation and scale tracks resampled at a uniform rate. Each frame stores all the baked
+	 * tracks as component arrays (all position X, then all position Y... then rotation X... then scale Z),
+	 * so sampling is a single linear blend of two contiguous frames plus a normalization of the rotations,
+	 * instead of a key search per track. Not saved; modifying the animation clears it.
+	 */
+
+	struct BakedTransforms {
+		double step = 0.0; // Time between frames.
+		uint32_t frame_count = 0;
+		uint32_t position_count = 0;
+		uint32_t rotation_count = 0;
+		uint32_t scale_count = 0;
+		uint32_t frame_stride = 0; // Floats per frame.
+		LocalVector<float> frames;
+		LocalVector<int32_t> track_slots; // Per track, its index among the baked tracks of its type, or -1.
+	} baked_transforms;
+
+	void _changed();
+
 	Vector3i _compress_key(uint32_t p_track, const AABB &p_bounds, int32_t p_key = -1, float p_time = 0.0);
 	bool _rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const;
 	bool _pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const;
@@ -509,6 +530,30 @@ public:
 	void optimize(real_t p_allowed_velocity_err = 0.01, real_t p_allowed_angular_err = 0.01, int p_precision = 3);
 	void compress(uint32_t p_page_size = 8192, uint32_t p_fps = 120, float p_split_tolerance = 4.0); // 4.0 seems to be the split tolerance sweet spot from many tests.
 
+	void bake_transforms(double p_fps = 30.0);
+	void clear_baked_transforms();
+	bool has_baked_transforms() const;
+	void sample_baked_transforms(double p_time, LocalVector<float> &r_sample) const;
+
+	_FORCE_INLINE_ int32_t baked_transforms_get_slot(int p_track) const {
+		return p_track < (int)baked_transforms.track_slots.size() ? baked_transforms.track_slots[p_track] : -1;
+	}
+	_FORCE_INLINE_ Vector3 baked_transforms_get_position(const LocalVector<float> &p_sample, int32_t p_slot) const {
+		const uint32_t n = baked_transforms.position_count;
+		const float *v = p_sample.ptr() + p_slot;
+		return Vector3(v[0], v[n], v[n * 2]);
+	}
+	_FORCE_INLINE_ Quaternion baked_transforms_get_rotation(const LocalVector<float> &p_sample, int32_t p_slot) const {
+		const uint32_t n = baked_transforms.rotation_count;
+		const float *v = p_sample.ptr() + baked_transforms.position_count * 3 + p_slot;
+		return Quaternion(v[0], v[n], v[n * 2], v[n * 3]);
+	}
+	_FORCE_INLINE_ Vector3 baked_transforms_get_scale(const LocalVector<float> &p_sample, int32_t p_slot) const {
+		const uint32_t n = baked_transforms.scale_count;
+		const float *v = p_sample.ptr() + baked_transforms.position_count * 3 + baked_transforms.rotation_count * 4 + p_slot;
+		return Vector3(v[0], v[n], v[n * 2]);
+	}
+
 	// Helper functions for Variant.
 	static bool is_variant_interpolatable(const Variant p_value);
 
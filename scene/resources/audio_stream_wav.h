@@ -160,6 +160,7 @@ public:
 
 	void set_data(const Vector<uint8_t> &p_data);
 	Vector<uint8_t> get_data() const;
+	virtual uint64_t estimate_memory_usage() const override;
 
 	Error save_to_wav(const String &p_path);
 
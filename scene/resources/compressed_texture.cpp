@@ -154,6 +154,7 @@ Error CompressedTexture2D::load(const String &p_path) {
 	h = lh;
 	path_to_file = p_path;
 	format = image->get_format();
+	mipmaps = image->has_mipmaps();
 
 	if (get_path().is_empty()) {
 		//temporarily set path if no path set for resource, helps find errors
@@ -211,6 +212,11 @@ RID CompressedTexture2D::get_rid() const {
 	return texture;
 }
 
+uint64_t CompressedTexture2D::estimate_memory_usage() const {
+	// The pixels live in video memory, but count them so large textures weigh accordingly.
+	return sizeof(CompressedTexture2D) + Image::get_image_data_size(w, h, format, mipmaps);
+}
+
 void CompressedTexture2D::draw(RID p_canvas_item, const Point2 &p_pos, const Color &p_modulate, bool p_transpose) const {
 	if ((w | h) == 0) {
 		return;
@@ -314,6 +320,9 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		uint64_t total_size = 0;
 
 		bool first = true;
+		// Size of the first mipmap actually loaded, which is smaller than the texture when a size limit applies.
+		int first_w = w;
+		int first_h = h;
 
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			uint32_t size = f->get_32();
@@ -348,6 +357,8 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				//format will actually be the format of the first image,
 				//as it may have changed on compression
 				format = img->get_format();
+				first_w = sw;
+				first_h = sh;
 				first = false;
 			} else if (img->get_format() != format) {
 				img->convert(format); //all needs to be the same format
@@ -389,7 +400,7 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				}
 			}
 
-			image->set_data(w, h, true, mipmap_images[0]->get_format(), img_data);
+			image->set_data(first_w, first_h, true, mipmap_images[0]->get_format(), img_data);
 			return image;
 		}
 
@@ -426,13 +437,15 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
-				}
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
 				continue; //oops, size limit enforced, go to next
 			}
 
+			// Offsets are relative to the first mipmap, so seek once past all the skipped ones.
+			if (ofs) {
+				f->seek(f->get_position() + ofs);
+			}
+
 			Vector<uint8_t> data;
 			data.resize(size - ofs);
 
@@ -148,6 +148,11 @@ RID ImageTexture::get_rid() const {
 	return texture;
 }
 
+uint64_t ImageTexture::estimate_memory_usage() const {
+	// The pixels live in video memory, but count them so large textures weigh accordingly.
+	return sizeof(ImageTexture) + Image::get_image_data_size(w, h, format, mipmaps);
+}
+
 bool ImageTexture::has_alpha() const {
 	return (format == Image::FORMAT_LA8 || format == Image::FORMAT_RGBA8);
 }
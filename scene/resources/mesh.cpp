@@ -1994,6 +1994,26 @@ RID ArrayMesh::get_rid() const {
 	return mesh;
 }
 
+uint64_t ArrayMesh::estimate_memory_usage() const {
+	// The arrays live in video memory, but count them so large meshes weigh accordingly.
+	uint64_t size = sizeof(ArrayMesh);
+	for (const Surface &surface : surfaces) {
+		uint32_t offsets[RS::ARRAY_MAX];
+		uint32_t vertex_element_size;
+		uint32_t normal_element_size;
+		uint32_t attrib_element_size;
+		uint32_t skin_element_size;
+		RS::get_singleton()->mesh_surface_make_offsets_from_format(surface.format, surface.array_length, surface.index_array_length, offsets, vertex_element_size, normal_element_size, attrib_element_size, skin_element_size);
+
+		const uint64_t vertex_size = vertex_element_size + normal_element_size + attrib_element_size + skin_element_size;
+		size += uint64_t(surface.array_length) * vertex_size;
+		// Blend shapes store their own positions, normals and tangents.
+		size += uint64_t(surface.array_length) * (vertex_element_size + normal_element_size) * blend_shapes.size();
+		size += uint64_t(surface.index_array_length) * (surface.array_length <= (1 << 16) ? 2 : 4);
+	}
+	return size;
+}
+
 AABB ArrayMesh::get_aabb() const {
 	return aabb;
 }
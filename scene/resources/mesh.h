@@ -383,6 +383,7 @@ public:
 
 	AABB get_aabb() const override;
 	virtual RID get_rid() const override;
+	virtual uint64_t estimate_memory_usage() const override;
 
 	void regen_normal_maps();
 
@@ -55,6 +55,26 @@ bool SceneState::can_instantiate() const {
 	return nodes.size() > 0;
 }
 
+uint64_t SceneState::estimate_memory_usage() const {
+	uint64_t size = sizeof(SceneState);
+	size += names.size() * sizeof(StringName) + node_paths.size() * sizeof(NodePath) + editable_instances.size() * sizeof(NodePath);
+	for (const NodeData &nd : nodes) {
+		size += sizeof(NodeData) + nd.properties.size() * sizeof(NodeData::Property) + nd.groups.size() * sizeof(int);
+	}
+	for (const ConnectionData &cd : connections) {
+		size += sizeof(ConnectionData) + cd.binds.size() * sizeof(int);
+	}
+	for (const Variant &v : variants) {
+		size += sizeof(Variant);
+		// Built-in resources are only kept alive by the scene, so they weigh with it. External ones are cached on their own.
+		Ref<Resource> res = v;
+		if (res.is_valid() && res->is_built_in()) {
+			size += res->estimate_memory_usage();
+		}
+	}
+	return size;
+}
+
 static Array _sanitize_node_pinned_properties(Node *p_node) {
 	Array pinned = p_node->get_meta("_edit_pinned_properties_", Array());
 	if (pinned.is_empty()) {
@@ -166,11 +186,25 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	bool use_node_setters = p_edit_state == GEN_EDIT_STATE_DISABLED;
+#ifdef TOOLS_ENABLED
+	// Object::set() also marks objects as edited, which the editor relies on.
+	use_node_setters = use_node_setters && !Engine::get_singleton()->is_editor_hint();
+#endif
+	if (use_node_setters && !node_setters_ready.is_set()) {
+		MutexLock lock(node_setters_mutex);
+		if (!node_setters_ready.is_set()) {
+			_build_node_setters();
+			node_setters_ready.set();
+		}
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
 
 		Node *parent = nullptr;
 		String old_parent_path;
+		const NodeSetters *setters = nullptr;
 
 		if (i > 0) {
 			ERR_FAIL_COND_V_MSG(n.parent == -1, nullptr, vformat("Invalid scene: node %s does not specify its parent node.", snames[n.name]));
@@ -294,6 +328,8 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 					node = Object::cast_to<Node>(obj);
 				}
+			} else if (use_node_setters && node->get_class_name() == node_setters[i].class_name) {
+				setters = &node_setters[i];
 			}
 		}
 
@@ -406,7 +442,21 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							const PropertySetter *setter = setters ? &setters->properties[j] : nullptr;
+							if (setter && setter->method && !node->get_script_instance()) {
+								// Same as what ClassDB::set_property() would do, without looking up the property.
+								Variant index = setter->index;
+								const Variant *args[2] = { &index, &value };
+								const Variant **argptrs = setter->index >= 0 ? args : args + 1;
+								if (value.get_type() == setter->validated_type) {
+									setter->method->validated_call(node, argptrs, nullptr);
+								} else {
+									Callable::CallError ce;
+									setter->method->call(node, argptrs, setter->index >= 0 ? 2 : 1, ce);
+								}
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -598,6 +648,53 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	return ret_nodes[0];
 }
 
+void SceneState::_build_node_setters() const {
+	node_setters.clear();
+	node_setters.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		if (n.type == TYPE_INSTANTIATED || n.instance >= 0 || (i == 0 && base_scene_idx >= 0)) {
+			continue; // Not created by this scene.
+		}
+		ERR_CONTINUE(n.type < 0 || n.type >= names.size());
+
+		NodeSetters &ns = node_setters[i];
+		ns.class_name = names[n.type];
+		ns.properties.resize(n.properties.size());
+
+		for (int j = 0; j < n.properties.size(); j++) {
+			int name_idx = n.properties[j].name;
+			if (name_idx & FLAG_PATH_PROPERTY_IS_NODE || name_idx < 0 || name_idx >= names.size()) {
+				continue;
+			}
+
+			PropertySetter &setter = ns.properties[j];
+			setter.method = ClassDB::get_property_setter_bind(ns.class_name, names[name_idx], &setter.index);
+			if (!setter.method || setter.method->is_vararg()) {
+				setter.method = nullptr;
+				continue;
+			}
+
+			int value_arg = setter.index >= 0 ? 1 : 0;
+			if (setter.method->get_argument_count() != value_arg + 1 || (value_arg && setter.method->get_argument_type(0) != Variant::INT)) {
+				setter.method = nullptr;
+				continue;
+			}
+			Variant::Type type = setter.method->get_argument_type(value_arg);
+			if (type != Variant::OBJECT) {
+				// Objects are left to call(), which checks their class.
+				setter.validated_type = type;
+			}
+		}
+	}
+}
+
+void SceneState::_clear_node_setters() {
+	node_setters_ready.clear();
+	node_setters.clear();
+}
+
 Variant SceneState::make_local_resource(Variant &p_value, const SceneState::NodeData &p_node_data, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_sub_scene, Node *p_node, const StringName p_sname, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_scene, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const {
 	Ref<Resource> res = p_value;
 	if (res.is_null() || !res->is_local_to_scene()) {
@@ -1206,6 +1303,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_node_setters();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1416,6 +1514,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	_clear_node_setters();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1897,6 +1997,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_clear_node_setters();
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -1913,6 +2014,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_clear_node_setters();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -2129,6 +2231,10 @@ void PackedScene::set_path_cache(const String &p_path) {
 	Resource::set_path_cache(p_path);
 }
 
+uint64_t PackedScene::estimate_memory_usage() const {
+	return sizeof(PackedScene) + state->estimate_memory_usage();
+}
+
 void PackedScene::reset_state() {
 	clear();
 }
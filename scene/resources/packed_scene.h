@@ -89,6 +89,26 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Setters of the properties of nodes created by this scene, resolved on first instantiation,
+	// so they can be called directly instead of being looked up by name in Object::set().
+	struct PropertySetter {
+		MethodBind *method = nullptr; // nullptr if the property must be set through Object::set().
+		int index = -1;
+		Variant::Type validated_type = Variant::NIL; // Values of this type can skip argument conversion.
+	};
+
+	struct NodeSetters {
+		StringName class_name;
+		LocalVector<PropertySetter> properties;
+	};
+
+	mutable LocalVector<NodeSetters> node_setters;
+	mutable SafeFlag node_setters_ready;
+	mutable BinaryMutex node_setters_mutex;
+
+	void _build_node_setters() const;
+	void _clear_node_setters();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -157,6 +177,8 @@ public:
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state) const;
 
+	uint64_t estimate_memory_usage() const;
+
 	Array setup_resources_in_array(Array &array_to_scan, const SceneState::NodeData &n, HashMap<Ref<Resource>, Ref<Resource>> &resources_local_to_sub_scene, Node *node, const StringName sname, HashMap<Ref<Resource>, Ref<Resource>> &resources_local_to_scene, int i, Node **ret_nodes, SceneState::GenEditState p_edit_state) const;
 	Variant make_local_resource(Variant &value, const SceneState::NodeData &p_node_data, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_sub_scene, Node *p_node, const StringName p_sname, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_scene, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const;
 	bool has_local_resource(const Array &p_array) const;
@@ -263,6 +285,7 @@ public:
 
 	virtual void set_path(const String &p_path, bool p_take_over = false) override;
 	virtual void set_path_cache(const String &p_path) override;
+	virtual uint64_t estimate_memory_usage() const override;
 
 #ifdef TOOLS_ENABLED
 	virtual void set_last_modified_time(uint64_t p_time) override {
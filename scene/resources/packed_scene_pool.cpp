@@ -0,0 +1,224 @@
+/**************************************************************************/
+/*  packed_scene_pool.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "packed_scene_pool.h"
+
+#include "core/core_string_names.h"
+
+// Values stored in the templates are shared by every instance, so anything specific to one of them can't be restored.
+bool PackedScenePool::_can_restore_value(const Variant &p_value) {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT: {
+			Ref<Resource> res = p_value;
+			if (res.is_valid()) {
+				return !res->is_local_to_scene();
+			}
+			return p_value.get_validated_object() == nullptr;
+		}
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			for (int i = 0; i < array.size(); i++) {
+				if (!_can_restore_value(array[i])) {
+					return false;
+				}
+			}
+			return true;
+		}
+		case Variant::DICTIONARY: {
+			const Dictionary dictionary = p_value;
+			return _can_restore_value(dictionary.keys()) && _can_restore_value(dictionary.values());
+		}
+		default: {
+			return true;
+		}
+	}
+}
+
+void PackedScenePool::_build_templates(Node *p_root, Node *p_node) {
+	NodeTemplate nt;
+	nt.path = p_root->get_path_to(p_node);
+	nt.class_name = p_node->get_class_name();
+	nt.child_count = p_node->get_child_count();
+
+	List<PropertyInfo> plist;
+	p_node->get_property_list(&plist);
+	for (const PropertyInfo &E : plist) {
+		if (!(E.usage & PROPERTY_USAGE_STORAGE) || E.name == CoreStringNames::get_singleton()->_script) {
+			continue;
+		}
+		Variant value = p_node->get(E.name);
+		if (_can_restore_value(value)) {
+			// Don't share arrays and dictionaries with the instance they come from.
+			nt.properties.push_back(Pair<StringName, Variant>(E.name, value.duplicate(true)));
+		}
+	}
+	node_templates.push_back(nt);
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_build_templates(p_root, p_node->get_child(i));
+	}
+}
+
+bool PackedScenePool::_reset_instance(Node *p_root) {
+	LocalVector<Node *> nodes;
+	nodes.resize(node_templates.size());
+
+	// Check the structure first, instances which had nodes added or removed can't be reused.
+	for (uint32_t i = 0; i < node_templates.size(); i++) {
+		const NodeTemplate &nt = node_templates[i];
+		Node *node = p_root->get_node_or_null(nt.path);
+		if (!node || node->get_class_name() != nt.class_name || node->get_child_count() != nt.child_count) {
+			return false;
+		}
+		nodes[i] = node;
+	}
+
+	// Only set what changed since the instance was created.
+	for (uint32_t i = 0; i < node_templates.size(); i++) {
+		Node *node = nodes[i];
+		for (const Pair<StringName, Variant> &E : node_templates[i].properties) {
+			if (node->get(E.first) == E.second) {
+				continue;
+			}
+			Variant::Type type = E.second.get_type();
+			node->set(E.first, type == Variant::ARRAY || type == Variant::DICTIONARY ? E.second.duplicate(true) : E.second);
+		}
+	}
+
+	return true;
+}
+
+void PackedScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+	clear();
+	scene = p_scene;
+}
+
+Ref<PackedScene> PackedScenePool::get_scene() const {
+	return scene;
+}
+
+void PackedScenePool::set_capacity(int p_capacity) {
+	ERR_FAIL_COND(p_capacity < 0);
+	capacity = p_capacity;
+	while ((int)available.size() > capacity) {
+		memdelete(available[available.size() - 1]);
+		available.resize(available.size() - 1);
+	}
+}
+
+int PackedScenePool::get_capacity() const {
+	return capacity;
+}
+
+int PackedScenePool::get_available_count() const {
+	return available.size();
+}
+
+void PackedScenePool::prewarm(int p_count) {
+	ERR_FAIL_COND_MSG(scene.is_null(), "No scene to instantiate was set.");
+
+	int count = MIN(p_count, capacity);
+	while ((int)available.size() < count) {
+		Node *node = scene->instantiate();
+		ERR_FAIL_NULL(node);
+		if (!templates_built) {
+			_build_templates(node, node);
+			templates_built = true;
+		}
+		available.push_back(node);
+	}
+}
+
+Node *PackedScenePool::acquire() {
+	if (!available.is_empty()) {
+		Node *node = available[available.size() - 1];
+		available.resize(available.size() - 1);
+		return node;
+	}
+
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "No scene to instantiate was set.");
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+	if (!templates_built) {
+		_build_templates(node, node);
+		templates_built = true;
+	}
+	return node;
+}
+
+void PackedScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(p_node->is_queued_for_deletion(), "Can't release a node that is queued for deletion.");
+	ERR_FAIL_COND_MSG(available.has(p_node), "Node was already released to the pool.");
+
+	// Leaving the tree keeps the resources of the nodes in the servers alive, they are just not used anymore.
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+	}
+
+	if ((int)available.size() >= capacity || !templates_built || !_reset_instance(p_node)) {
+		// Usually called from a script or signal of the instance itself, so it can't be freed right away.
+		p_node->queue_free();
+		return;
+	}
+	available.push_back(p_node);
+}
+
+void PackedScenePool::clear() {
+	for (Node *node : available) {
+		memdelete(node);
+	}
+	available.clear();
+	node_templates.clear();
+	templates_built = false;
+}
+
+void PackedScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &PackedScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &PackedScenePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_capacity", "capacity"), &PackedScenePool::set_capacity);
+	ClassDB::bind_method(D_METHOD("get_capacity"), &PackedScenePool::get_capacity);
+	ClassDB::bind_method(D_METHOD("get_available_count"), &PackedScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &PackedScenePool::prewarm);
+	ClassDB::bind_method(D_METHOD("acquire"), &PackedScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &PackedScenePool::release);
+	ClassDB::bind_method(D_METHOD("clear"), &PackedScenePool::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "capacity", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), "set_capacity", "get_capacity");
+}
+
+PackedScenePool::~PackedScenePool() {
+	clear();
+}
@@ -0,0 +1,78 @@
+/**************************************************************************/
+/*  packed_scene_pool.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef PACKED_SCENE_POOL_H
+#define PACKED_SCENE_POOL_H
+
+#include "scene/resources/packed_scene.h"
+
+class PackedScenePool : public RefCounted {
+	GDCLASS(PackedScenePool, RefCounted);
+
+	// Values of a freshly instantiated scene, which released instances are reset to.
+	struct NodeTemplate {
+		NodePath path;
+		StringName class_name;
+		int child_count = 0;
+		LocalVector<Pair<StringName, Variant>> properties;
+	};
+
+	Ref<PackedScene> scene;
+	int capacity = 32;
+
+	LocalVector<NodeTemplate> node_templates;
+	bool templates_built = false;
+	LocalVector<Node *> available;
+
+	static bool _can_restore_value(const Variant &p_value);
+	void _build_templates(Node *p_root, Node *p_node);
+	bool _reset_instance(Node *p_root);
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_scene(const Ref<PackedScene> &p_scene);
+	Ref<PackedScene> get_scene() const;
+
+	void set_capacity(int p_capacity);
+	int get_capacity() const;
+
+	int get_available_count() const;
+
+	void prewarm(int p_count);
+	Node *acquire();
+	void release(Node *p_node);
+	void clear();
+
+	~PackedScenePool();
+};
+
+#endif // PACKED_SCENE_POOL_H
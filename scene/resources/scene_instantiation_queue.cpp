@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*  scene_instantiation_queue.cpp                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_instantiation_queue.h"
+
+#include "core/os/os.h"
+
+void SceneInstantiationQueue::_instantiate_task(void *p_request) {
+	Request *request = (Request *)p_request;
+	request->node = request->scene->instantiate();
+}
+
+void SceneInstantiationQueue::push(const Ref<PackedScene> &p_scene, Node *p_parent) {
+	ERR_FAIL_COND(p_scene.is_null());
+	ERR_FAIL_NULL(p_parent);
+
+	Request &request = requests.push_back(Request())->get();
+	request.scene = p_scene;
+	request.parent = p_parent->get_instance_id();
+	request.task = WorkerThreadPool::get_singleton()->add_native_task(&SceneInstantiationQueue::_instantiate_task, &request, false, "Instantiate scene: " + p_scene->get_path());
+}
+
+int SceneInstantiationQueue::commit(int p_time_budget_usec) {
+	ERR_FAIL_COND_V_MSG(!Thread::is_main_thread(), 0, "Instances can only be added to the tree from the main thread.");
+
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	int added = 0;
+
+	while (!requests.is_empty()) {
+		Request &request = requests.front()->get();
+		// Keep the order of the requests, even if later ones are done first.
+		if (!WorkerThreadPool::get_singleton()->is_task_completed(request.task)) {
+			break;
+		}
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(request.task);
+
+		Node *node = request.node;
+		Node *parent = Object::cast_to<Node>(ObjectDB::get_instance(request.parent));
+		requests.pop_front();
+
+		if (!node) {
+			continue; // Instantiation failed, the error was already printed.
+		}
+		if (!parent) {
+			memdelete(node); // Parent was freed meanwhile.
+			continue;
+		}
+
+		parent->add_child(node);
+		added++;
+		emit_signal(SNAME("node_added"), node);
+
+		if (OS::get_singleton()->get_ticks_usec() - start >= (uint64_t)p_time_budget_usec) {
+			break;
+		}
+	}
+
+	return added;
+}
+
+int SceneInstantiationQueue::get_pending_count() const {
+	return requests.size();
+}
+
+void SceneInstantiationQueue::clear() {
+	for (Request &request : requests) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(request.task);
+		if (request.node) {
+			memdelete(request.node);
+		}
+	}
+	requests.clear();
+}
+
+void SceneInstantiationQueue::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("push", "scene", "parent"), &SceneInstantiationQueue::push);
+	ClassDB::bind_method(D_METHOD("commit", "time_budget_usec"), &SceneInstantiationQueue::commit, DEFVAL(2000));
+	ClassDB::bind_method(D_METHOD("get_pending_count"), &SceneInstantiationQueue::get_pending_count);
+	ClassDB::bind_method(D_METHOD("clear"), &SceneInstantiationQueue::clear);
+
+	ADD_SIGNAL(MethodInfo("node_added", PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, "Node")));
+}
+
+SceneInstantiationQueue::~SceneInstantiationQueue() {
+	clear();
+}
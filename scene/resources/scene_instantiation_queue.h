@@ -0,0 +1,63 @@
+/**************************************************************************/
+/*  scene_instantiation_queue.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SCENE_INSTANTIATION_QUEUE_H
+#define SCENE_INSTANTIATION_QUEUE_H
+
+#include "core/object/worker_thread_pool.h"
+#include "scene/resources/packed_scene.h"
+
+class SceneInstantiationQueue : public RefCounted {
+	GDCLASS(SceneInstantiationQueue, RefCounted);
+
+	struct Request {
+		Ref<PackedScene> scene;
+		ObjectID parent;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+		Node *node = nullptr; // Set by the task, nodes outside of the tree can be built from any thread.
+	};
+
+	List<Request> requests;
+
+	static void _instantiate_task(void *p_request);
+
+protected:
+	static void _bind_methods();
+
+public:
+	void push(const Ref<PackedScene> &p_scene, Node *p_parent);
+	int commit(int p_time_budget_usec = 2000);
+	int get_pending_count() const;
+	void clear();
+
+	~SceneInstantiationQueue();
+};
+
+#endif // SCENE_INSTANTIATION_QUEUE_H
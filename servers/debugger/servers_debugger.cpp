@@ -34,6 +34,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/engine_profiler.h"
 #include "core/io/marshalls.h"
+#include "core/os/thread.h"
 #include "servers/display_server.h"
 
 #define CHECK_SIZE(arr, expected, what) ERR_FAIL_COND_V_MSG((uint32_t)arr.size() < (uint32_t)(expected), false, String("Malformed ") + what + " message from script debugger, message too short. Expected size: " + itos(expected) + ", actual size: " + itos(arr.size()))
@@ -87,6 +88,30 @@ bool ServersDebugger::ScriptFunctionSignature::deserialize(const Array &p_arr) {
 	return true;
 }
 
+Array ServersDebugger::ScriptSampledStacks::serialize() {
+	Array arr;
+	arr.push_back(stacks.size() * 2);
+	for (const KeyValue<String, uint64_t> &E : stacks) {
+		arr.push_back(E.key);
+		arr.push_back(E.value);
+	}
+	return arr;
+}
+
+bool ServersDebugger::ScriptSampledStacks::deserialize(const Array &p_arr) {
+	CHECK_SIZE(p_arr, 1, "ScriptSampledStacks");
+	uint32_t size = p_arr[0];
+	ERR_FAIL_COND_V(size % 2, false);
+	CHECK_SIZE(p_arr, 1 + size, "ScriptSampledStacks");
+	uint32_t idx = 1;
+	while (idx < 1 + size) {
+		stacks[p_arr[idx]] = p_arr[idx + 1];
+		idx += 2;
+	}
+	CHECK_END(p_arr, idx, "ScriptSampledStacks");
+	return true;
+}
+
 Array ServersDebugger::ServersProfilerFrame::serialize() {
 	Array arr;
 	arr.push_back(frame_number);
@@ -387,6 +412,78 @@ public:
 	}
 };
 
+// Unlike ScriptsProfiler, which times every call, this one periodically asks the
+// script languages for a sample of their call stack from a separate thread.
+class ServersDebugger::ScriptsSamplingProfiler : public EngineProfiler {
+	ServersDebugger::ScriptSampledStacks sampled;
+	Thread thread;
+	SafeFlag exit_thread;
+	uint64_t interval_usec = 1000;
+
+	static void _thread_func(void *p_user) {
+		ScriptsSamplingProfiler *profiler = static_cast<ScriptsSamplingProfiler *>(p_user);
+		while (!profiler->exit_thread.is_set()) {
+			OS::get_singleton()->delay_usec(profiler->interval_usec);
+			for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+				ScriptServer::get_language(i)->profiling_request_sample();
+			}
+		}
+	}
+
+	void _gather_samples() {
+		for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+			ScriptServer::get_language(i)->profiling_get_sampled_stacks(sampled.stacks);
+		}
+	}
+
+	void _stop_thread() {
+		if (thread.is_started()) {
+			exit_thread.set();
+			thread.wait_to_finish();
+		}
+	}
+
+public:
+	void toggle(bool p_enable, const Array &p_opts) {
+		if (p_enable) {
+			if (thread.is_started()) {
+				return;
+			}
+			sampled.stacks.clear();
+			if (p_opts.size() > 0 && p_opts[0].get_type() == Variant::INT) {
+				interval_usec = MAX(100, int64_t(p_opts[0]));
+			}
+			for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+				ScriptServer::get_language(i)->profiling_sampling_start();
+			}
+			exit_thread.clear();
+			thread.start(_thread_func, this);
+		} else {
+			if (!thread.is_started()) {
+				return;
+			}
+			_stop_thread();
+			for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+				ScriptServer::get_language(i)->profiling_sampling_stop();
+			}
+			_gather_samples();
+			EngineDebugger::get_singleton()->send_message("sampling:profile_total", sampled.serialize());
+			sampled.stacks.clear();
+		}
+	}
+
+	void add(const Array &p_data) {}
+
+	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+		// Keep the per-language buffers small, the totals are only sent when stopping.
+		_gather_samples();
+	}
+
+	~ScriptsSamplingProfiler() {
+		_stop_thread();
+	}
+};
+
 ServersDebugger *ServersDebugger::singleton = nullptr;
 
 void ServersDebugger::initialize() {
@@ -462,6 +559,10 @@ ServersDebugger::ServersDebugger() {
 	visual_profiler.instantiate();
 	visual_profiler->bind("visual");
 
+	// Script sampling profiler (collapsed call stacks)
+	sampling_profiler.instantiate();
+	sampling_profiler->bind("sampling");
+
 	EngineDebugger::Capture servers_cap(nullptr, &_capture);
 	EngineDebugger::register_message_capture("servers", servers_cap);
 }
@@ -72,6 +72,14 @@ public:
 		double internal_time = 0;
 	};
 
+	// Script sampling profiler
+	struct ScriptSampledStacks {
+		HashMap<String, uint64_t> stacks;
+
+		Array serialize();
+		bool deserialize(const Array &p_arr);
+	};
+
 	// Servers profiler
 	struct ServerFunctionInfo {
 		StringName name;
@@ -110,10 +118,12 @@ private:
 	class ScriptsProfiler;
 	class ServersProfiler;
 	class VisualProfiler;
+	class ScriptsSamplingProfiler;
 
 	double last_draw_time = 0.0;
 	Ref<ServersProfiler> servers_profiler;
 	Ref<VisualProfiler> visual_profiler;
+	Ref<ScriptsSamplingProfiler> sampling_profiler;
 
 	static ServersDebugger *singleton;
 
@@ -0,0 +1,307 @@
+/**************************************************************************/
+/*  cpu_skinning.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "cpu_skinning.h"
+
+#include "core/object/worker_thread_pool.h"
+
+namespace {
+
+struct BlendShapeTask {
+	CPUSkinning::Surface surface;
+	RS::BlendShapeMode mode;
+	const CPUSkinning::BlendShape *blend_shapes;
+	uint32_t blend_shape_count;
+	CPUSkinning::Output output;
+};
+
+struct SkinTask {
+	CPUSkinning::Surface surface;
+	CPUSkinning::Skin skin;
+	CPUSkinning::Output output;
+};
+
+void _blend_shapes_range(const BlendShapeTask &p_task, uint32_t p_from, uint32_t p_to) {
+	const CPUSkinning::Surface &surface = p_task.surface;
+	const CPUSkinning::Output &output = p_task.output;
+	const bool use_normals = surface.normals && output.normals;
+	const bool use_tangents = surface.tangents && output.tangents;
+	const bool normalized = p_task.mode == RS::BLEND_SHAPE_MODE_NORMALIZED;
+
+	for (uint32_t i = p_from; i < p_to; i++) {
+		// Read the base attributes before writing, so the output can alias them.
+		const Vector3 base_vertex = surface.vertices[i];
+		Vector3 vertex = base_vertex;
+		Vector3 base_normal;
+		Vector3 normal;
+		float base_tangent[3] = {};
+		float tangent[3] = {};
+
+		if (use_normals) {
+			base_normal = surface.normals[i];
+			normal = base_normal;
+		}
+		if (use_tangents) {
+			for (int k = 0; k < 3; k++) {
+				base_tangent[k] = surface.tangents[i * 4 + k];
+				tangent[k] = base_tangent[k];
+			}
+		}
+
+		for (uint32_t j = 0; j < p_task.blend_shape_count; j++) {
+			const CPUSkinning::BlendShape &shape = p_task.blend_shapes[j];
+			const float weight = shape.weight;
+
+			// Normalized shapes store absolute attributes, relative ones store offsets.
+			vertex += (normalized ? shape.vertices[i] - base_vertex : shape.vertices[i]) * weight;
+			if (use_normals && shape.normals) {
+				normal += (normalized ? shape.normals[i] - base_normal : shape.normals[i]) * weight;
+			}
+			if (use_tangents && shape.tangents) {
+				for (int k = 0; k < 3; k++) {
+					const float value = shape.tangents[i * 4 + k];
+					tangent[k] += (normalized ? value - base_tangent[k] : value) * weight;
+				}
+			}
+		}
+
+		output.vertices[i] = vertex;
+		if (use_normals) {
+			output.normals[i] = normal;
+		}
+		if (use_tangents) {
+			// The binormal sign in W is not blended.
+			const float sign = surface.tangents[i * 4 + 3];
+			for (int k = 0; k < 3; k++) {
+				output.tangents[i * 4 + k] = tangent[k];
+			}
+			output.tangents[i * 4 + 3] = sign;
+		}
+	}
+}
+
+template <uint32_t Influences>
+void _skin_range_influences(const SkinTask &p_task, uint32_t p_from, uint32_t p_to) {
+	const CPUSkinning::Surface &surface = p_task.surface;
+	const CPUSkinning::Skin &skin = p_task.skin;
+	const CPUSkinning::Output &output = p_task.output;
+	const bool use_normals = surface.normals && output.normals;
+	const bool use_tangents = surface.tangents && output.tangents;
+
+	for (uint32_t i = p_from; i < p_to; i++) {
+		// Blend the bone matrices first like the GPU skeleton shader does, so every
+		// attribute costs a single matrix multiply. The loops have fixed trip counts
+		// and no branches, so the compiler unrolls and vectorizes them.
+		const int *bones = skin.bones + i * Influences;
+		const float *weights = skin.weights + i * Influences;
+		float m[CPUSkinning::BONE_STRIDE_3D];
+		{
+			const uint32_t bone = uint32_t(bones[0]);
+			// Out of range bones get no influence instead of reading out of bounds.
+			const bool valid = bone < skin.bone_count;
+			const float weight = valid ? weights[0] : 0.0f;
+			const float *bone_transform = skin.bone_transforms + (valid ? bone : 0) * CPUSkinning::BONE_STRIDE_3D;
+			for (uint32_t k = 0; k < CPUSkinning::BONE_STRIDE_3D; k++) {
+				m[k] = bone_transform[k] * weight;
+			}
+		}
+		for (uint32_t j = 1; j < Influences; j++) {
+			const uint32_t bone = uint32_t(bones[j]);
+			const bool valid = bone < skin.bone_count;
+			const float weight = valid ? weights[j] : 0.0f;
+			const float *bone_transform = skin.bone_transforms + (valid ? bone : 0) * CPUSkinning::BONE_STRIDE_3D;
+			for (uint32_t k = 0; k < CPUSkinning::BONE_STRIDE_3D; k++) {
+				m[k] += bone_transform[k] * weight;
+			}
+		}
+
+		const Vector3 v = surface.vertices[i];
+		output.vertices[i] = Vector3(
+				m[0] * v.x + m[1] * v.y + m[2] * v.z + m[3],
+				m[4] * v.x + m[5] * v.y + m[6] * v.z + m[7],
+				m[8] * v.x + m[9] * v.y + m[10] * v.z + m[11]);
+
+		if (use_normals) {
+			const Vector3 n = surface.normals[i];
+			const Vector3 normal = Vector3(
+					m[0] * n.x + m[1] * n.y + m[2] * n.z,
+					m[4] * n.x + m[5] * n.y + m[6] * n.z,
+					m[8] * n.x + m[9] * n.y + m[10] * n.z);
+			output.normals[i] = normal.normalized();
+		}
+
+		if (use_tangents) {
+			const float *t = surface.tangents + i * 4;
+			const float sign = t[3];
+			Vector3 tangent = Vector3(
+					m[0] * t[0] + m[1] * t[1] + m[2] * t[2],
+					m[4] * t[0] + m[5] * t[1] + m[6] * t[2],
+					m[8] * t[0] + m[9] * t[1] + m[10] * t[2]);
+			tangent.normalize();
+			float *out = output.tangents + i * 4;
+			out[0] = tangent.x;
+			out[1] = tangent.y;
+			out[2] = tangent.z;
+			out[3] = sign;
+		}
+	}
+}
+
+void _skin_range(const SkinTask &p_task, uint32_t p_from, uint32_t p_to) {
+	if (p_task.skin.influences == 8) {
+		_skin_range_influences<8>(p_task, p_from, p_to);
+	} else {
+		_skin_range_influences<4>(p_task, p_from, p_to);
+	}
+}
+
+template <typename T, void (*Range)(const T &, uint32_t, uint32_t)>
+void _process_block(void *p_userdata, uint32_t p_block) {
+	const T &task = *(const T *)p_userdata;
+	const uint32_t from = p_block * CPUSkinning::BLOCK_SIZE;
+	const uint32_t to = MIN(from + CPUSkinning::BLOCK_SIZE, task.surface.vertex_count);
+	Range(task, from, to);
+}
+
+template <typename T, void (*Range)(const T &, uint32_t, uint32_t)>
+void _process(T &p_task, bool p_multithreaded, const char *p_description) {
+	const uint32_t block_count = Math::division_round_up(p_task.surface.vertex_count, CPUSkinning::BLOCK_SIZE);
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+	if (!p_multithreaded || block_count < 2 || !pool || pool->get_thread_count() < 2) {
+		Range(p_task, 0, p_task.surface.vertex_count);
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = pool->add_native_group_task(&_process_block<T, Range>, &p_task, block_count, -1, true, p_description);
+	pool->wait_for_group_task_completion(group_task);
+}
+
+} // namespace
+
+void CPUSkinning::store_bone_transform(const Transform3D &p_transform, float *r_bone) {
+	for (int i = 0; i < 3; i++) {
+		r_bone[i * 4 + 0] = p_transform.basis.rows[i][0];
+		r_bone[i * 4 + 1] = p_transform.basis.rows[i][1];
+		r_bone[i * 4 + 2] = p_transform.basis.rows[i][2];
+		r_bone[i * 4 + 3] = p_transform.origin[i];
+	}
+}
+
+void CPUSkinning::blend_shapes(const Surface &p_surface, RS::BlendShapeMode p_mode, const BlendShape *p_blend_shapes, uint32_t p_blend_shape_count, const Output &r_output, bool p_multithreaded) {
+	ERR_FAIL_NULL(p_surface.vertices);
+	ERR_FAIL_NULL(r_output.vertices);
+	ERR_FAIL_COND(p_blend_shape_count > 0 && !p_blend_shapes);
+
+	// Shapes with no influence are skipped up front, so the vertex loop only has useful work.
+	LocalVector<BlendShape> active_shapes;
+	for (uint32_t i = 0; i < p_blend_shape_count; i++) {
+		if (Math::abs(p_blend_shapes[i].weight) <= 0.0001f) {
+			continue;
+		}
+		ERR_FAIL_NULL(p_blend_shapes[i].vertices);
+		active_shapes.push_back(p_blend_shapes[i]);
+	}
+
+	BlendShapeTask task;
+	task.surface = p_surface;
+	task.mode = p_mode;
+	task.blend_shapes = active_shapes.ptr();
+	task.blend_shape_count = active_shapes.size();
+	task.output = r_output;
+
+	_process<BlendShapeTask, _blend_shapes_range>(task, p_multithreaded, "CPUSkinningBlendShapes");
+}
+
+void CPUSkinning::skin(const Surface &p_surface, const Skin &p_skin, const Output &r_output, bool p_multithreaded) {
+	ERR_FAIL_NULL(p_surface.vertices);
+	ERR_FAIL_NULL(r_output.vertices);
+	ERR_FAIL_NULL(p_skin.bones);
+	ERR_FAIL_NULL(p_skin.weights);
+	ERR_FAIL_NULL(p_skin.bone_transforms);
+	ERR_FAIL_COND(p_skin.bone_count == 0);
+	ERR_FAIL_COND_MSG(p_skin.influences != 4 && p_skin.influences != 8, "Skinning only supports 4 or 8 bone influences per vertex.");
+
+	SkinTask task;
+	task.surface = p_surface;
+	task.skin = p_skin;
+	task.output = r_output;
+
+	_process<SkinTask, _skin_range>(task, p_multithreaded, "CPUSkinningSkin");
+}
+
+bool CPUSkinning::skin_aabb(const AABB *p_bone_aabbs, uint32_t p_bone_count, const float *p_bone_transforms, bool p_2d, const Transform3D &p_mesh_to_skeleton, AABB &r_aabb) {
+	bool found_bone_aabb = false;
+	const uint32_t stride = p_2d ? BONE_STRIDE_2D : BONE_STRIDE_3D;
+
+	for (uint32_t i = 0; i < p_bone_count; i++) {
+		if (p_bone_aabbs[i].size == Vector3(-1, -1, -1)) {
+			continue; //bone is unused
+		}
+
+		const float *dataptr = p_bone_transforms + i * stride;
+
+		Transform3D mtx;
+
+		mtx.basis.rows[0][0] = dataptr[0];
+		mtx.basis.rows[0][1] = dataptr[1];
+		mtx.origin.x = dataptr[3];
+		mtx.basis.rows[1][0] = dataptr[4];
+		mtx.basis.rows[1][1] = dataptr[5];
+		mtx.origin.y = dataptr[7];
+
+		if (!p_2d) {
+			mtx.basis.rows[0][2] = dataptr[2];
+			mtx.basis.rows[1][2] = dataptr[6];
+			mtx.basis.rows[2][0] = dataptr[8];
+			mtx.basis.rows[2][1] = dataptr[9];
+			mtx.basis.rows[2][2] = dataptr[10];
+			mtx.origin.z = dataptr[11];
+		}
+
+		// Transform bounds to skeleton's space before applying animation data.
+		AABB baabb = p_mesh_to_skeleton.xform(p_bone_aabbs[i]);
+		baabb = mtx.xform(baabb);
+
+		if (!found_bone_aabb) {
+			r_aabb = baabb;
+			found_bone_aabb = true;
+		} else {
+			r_aabb.merge_with(baabb);
+		}
+	}
+
+	if (found_bone_aabb) {
+		// Transform skeleton bounds back to mesh's space if any animated AABB applied.
+		r_aabb = p_mesh_to_skeleton.affine_inverse().xform(r_aabb);
+	}
+
+	return found_bone_aabb;
+}
@@ -0,0 +1,90 @@
+/**************************************************************************/
+/*  cpu_skinning.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef CPU_SKINNING_H
+#define CPU_SKINNING_H
+
+#include "core/math/aabb.h"
+#include "core/math/transform_3d.h"
+#include "servers/rendering_server.h"
+
+// Skinning and blend shape kernels for code that needs deformed vertices on the CPU: the skeleton
+// AABB of the RD and GLES3 renderers, and MeshInstance3D baking a posed mesh. They match what the
+// GPU skeleton shaders compute, and split large meshes across the WorkerThreadPool.
+class CPUSkinning {
+public:
+	// Bone transforms use the layout of the renderers' skeleton data:
+	// the three rows of a 3x4 matrix (12 floats) for 3D skeletons, or two rows (8 floats) for 2D ones.
+	static constexpr uint32_t BONE_STRIDE_3D = 12;
+	static constexpr uint32_t BONE_STRIDE_2D = 8;
+
+	// Vertices processed per task when multithreading.
+	static constexpr uint32_t BLOCK_SIZE = 4096;
+
+	struct BlendShape {
+		const Vector3 *vertices = nullptr;
+		const Vector3 *normals = nullptr;
+		const float *tangents = nullptr; // 4 floats per vertex.
+		float weight = 0.0;
+	};
+
+	struct Surface {
+		uint32_t vertex_count = 0;
+		const Vector3 *vertices = nullptr;
+		const Vector3 *normals = nullptr; // Optional.
+		const float *tangents = nullptr; // Optional, 4 floats per vertex.
+	};
+
+	struct Skin {
+		const int *bones = nullptr;
+		const float *weights = nullptr;
+		uint32_t influences = 4; // Bones per vertex, 4 or 8.
+		const float *bone_transforms = nullptr; // BONE_STRIDE_3D floats per bone.
+		uint32_t bone_count = 0;
+	};
+
+	struct Output {
+		Vector3 *vertices = nullptr;
+		Vector3 *normals = nullptr; // Written when both the surface and output have normals.
+		float *tangents = nullptr; // Written when both the surface and output have tangents.
+	};
+
+	static void store_bone_transform(const Transform3D &p_transform, float *r_bone);
+
+	// Output may alias the surface arrays.
+	static void blend_shapes(const Surface &p_surface, RS::BlendShapeMode p_mode, const BlendShape *p_blend_shapes, uint32_t p_blend_shape_count, const Output &r_output, bool p_multithreaded = true);
+	static void skin(const Surface &p_surface, const Skin &p_skin, const Output &r_output, bool p_multithreaded = true);
+
+	// Merges the bone AABBs of a surface once posed by the skeleton, in the space of the mesh.
+	// Returns false if no bone is used by the surface.
+	static bool skin_aabb(const AABB *p_bone_aabbs, uint32_t p_bone_count, const float *p_bone_transforms, bool p_2d, const Transform3D &p_mesh_to_skeleton, AABB &r_aabb);
+};
+
+#endif // CPU_SKINNING_H
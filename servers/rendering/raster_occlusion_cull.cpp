@@ -0,0 +1,544 @@
+/**************************************************************************/
+/*  raster_occlusion_cull.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "raster_occlusion_cull.h"
+
+#include "core/object/worker_thread_pool.h"
+
+// Computes the screen space plane equation interpolating the values at the three vertices.
+static _FORCE_INLINE_ void _setup_plane(double r_plane[3], const double p_values[3], const double p_x[3], const double p_y[3], double p_area) {
+	r_plane[0] = ((p_values[1] - p_values[0]) * (p_y[2] - p_y[0]) - (p_values[2] - p_values[0]) * (p_y[1] - p_y[0])) / p_area;
+	r_plane[1] = ((p_values[2] - p_values[0]) * (p_x[1] - p_x[0]) - (p_values[1] - p_values[0]) * (p_x[2] - p_x[0])) / p_area;
+	r_plane[2] = p_values[0] - r_plane[0] * p_x[0] - r_plane[1] * p_y[0];
+}
+
+void RasterOcclusionCull::RasterHZBuffer::clear() {
+	HZBuffer::clear();
+
+	thread_triangles.clear();
+	thread_bins.clear();
+	tile_grid_size = Size2i();
+	thread_count = 0;
+}
+
+void RasterOcclusionCull::RasterHZBuffer::resize(const Size2i &p_size) {
+	if (p_size == Size2i()) {
+		clear();
+		return;
+	}
+
+	if (!sizes.is_empty() && p_size == sizes[0]) {
+		return; // Size didn't change
+	}
+
+	HZBuffer::resize(p_size);
+
+	tile_grid_size = Size2i((p_size.x + TILE_SIZE - 1) / TILE_SIZE, (p_size.y + TILE_SIZE - 1) / TILE_SIZE);
+	thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+
+	thread_triangles.resize(thread_count);
+	thread_bins.resize(thread_count * tile_grid_size.x * tile_grid_size.y);
+}
+
+void RasterOcclusionCull::RasterHZBuffer::rasterize(const Mesh *p_meshes, uint32_t p_mesh_count, const Transform3D &p_cam_transform, const Projection &p_cam_projection) {
+	ERR_FAIL_COND(is_empty());
+
+	SetupThreadData td;
+	td.meshes = p_meshes;
+	td.mesh_count = p_mesh_count;
+	for (uint32_t i = 0; i < p_mesh_count; i++) {
+		td.triangle_count += p_meshes[i].index_count / 3;
+	}
+	td.cam_inv_transform = p_cam_transform.affine_inverse();
+	td.cam_projection = p_cam_projection;
+	td.z_near = p_cam_projection.get_z_near();
+
+	debug_tex_range = p_cam_projection.get_z_far();
+
+	for (LocalVector<Triangle> &triangles : thread_triangles) {
+		triangles.clear();
+	}
+	for (LocalVector<uint32_t> &bin : thread_bins) {
+		bin.clear();
+	}
+
+	// Transform, clip and bin the triangles.
+	if (td.triangle_count > 256) {
+		td.thread_count = thread_count;
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_setup_triangles_threaded, &td, td.thread_count, -1, true, SNAME("RasterOcclusionCullSetup"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (td.triangle_count > 0) {
+		td.thread_count = 1;
+		_setup_triangles_threaded(0, &td);
+	}
+
+	// Rasterize each tile on its own, tiles are also cleared here so this must run even without occluders.
+	uint32_t tile_count = tile_grid_size.x * tile_grid_size.y;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_rasterize_tile_threaded, (void *)nullptr, tile_count, -1, true, SNAME("RasterOcclusionCullRasterize"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	update_mips();
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_setup_triangles_threaded(uint32_t p_thread, const SetupThreadData *p_data) {
+	uint32_t total_triangles = p_data->triangle_count;
+	uint32_t total_threads = p_data->thread_count;
+	uint32_t from = uint64_t(p_thread) * total_triangles / total_threads;
+	uint32_t to = (p_thread + 1 == total_threads) ? total_triangles : (uint64_t(p_thread + 1) * total_triangles / total_threads);
+
+	const float z_near = p_data->z_near;
+	uint32_t mesh_from = 0;
+
+	for (uint32_t i = 0; i < p_data->mesh_count && mesh_from < to; i++) {
+		const Mesh &mesh = p_data->meshes[i];
+		uint32_t mesh_to = mesh_from + mesh.index_count / 3;
+
+		for (uint32_t j = MAX(from, mesh_from); j < MIN(to, mesh_to); j++) {
+			const uint32_t *indices = &mesh.indices[(j - mesh_from) * 3];
+
+			Vector3 view[3];
+			bool all_inside = true;
+			bool all_outside = true;
+			for (int k = 0; k < 3; k++) {
+				view[k] = p_data->cam_inv_transform.xform(mesh.vertices[indices[k]]);
+				bool inside = -view[k].z >= z_near;
+				all_inside = all_inside && inside;
+				all_outside = all_outside && !inside;
+			}
+
+			if (all_outside) {
+				continue;
+			}
+
+			if (all_inside) {
+				_setup_triangle(p_thread, view, p_data->cam_projection);
+				continue;
+			}
+
+			// Clipping against the near plane results in a polygon of up to four vertices.
+			Vector3 clipped[4];
+			int clipped_count = 0;
+			for (int k = 0; k < 3; k++) {
+				const Vector3 &a = view[k];
+				const Vector3 &b = view[(k + 1) % 3];
+				real_t dist_a = -a.z - z_near;
+				real_t dist_b = -b.z - z_near;
+
+				if (dist_a >= 0) {
+					clipped[clipped_count++] = a;
+				}
+				if ((dist_a >= 0) != (dist_b >= 0)) {
+					clipped[clipped_count++] = a.lerp(b, dist_a / (dist_a - dist_b));
+				}
+			}
+
+			for (int k = 1; k + 1 < clipped_count; k++) {
+				Vector3 triangle[3] = { clipped[0], clipped[k], clipped[k + 1] };
+				_setup_triangle(p_thread, triangle, p_data->cam_projection);
+			}
+		}
+
+		mesh_from = mesh_to;
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_setup_triangle(uint32_t p_thread, const Vector3 p_view[3], const Projection &p_cam_projection) {
+	const Size2i &buffer_size = sizes[0];
+
+	double x[3];
+	double y[3];
+	double depth_over_w[3];
+	double one_over_w[3];
+
+	for (int i = 0; i < 3; i++) {
+		Plane projected = p_cam_projection.xform4(Plane(p_view[i], 1.0));
+		double inv_w = 1.0 / projected.d;
+		x[i] = (projected.normal.x * inv_w * 0.5 + 0.5) * buffer_size.x;
+		y[i] = (projected.normal.y * inv_w * 0.5 + 0.5) * buffer_size.y;
+		depth_over_w[i] = -p_view[i].z * inv_w;
+		one_over_w[i] = inv_w;
+	}
+
+	double area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+	if (!(Math::abs(area) > CMP_EPSILON)) {
+		return; // Degenerate (or NaN).
+	}
+
+	if (area < 0) {
+		// Occluders are double-sided, make the winding counter-clockwise so the edge functions are positive inside.
+		SWAP(x[1], x[2]);
+		SWAP(y[1], y[2]);
+		SWAP(depth_over_w[1], depth_over_w[2]);
+		SWAP(one_over_w[1], one_over_w[2]);
+		area = -area;
+	}
+
+	double min_x = MAX(MIN(x[0], MIN(x[1], x[2])), 0.0);
+	double max_x = MIN(MAX(x[0], MAX(x[1], x[2])), double(buffer_size.x));
+	double min_y = MAX(MIN(y[0], MIN(y[1], y[2])), 0.0);
+	double max_y = MIN(MAX(y[0], MAX(y[1], y[2])), double(buffer_size.y));
+
+	Triangle triangle;
+	triangle.min_y = Math::ceil(min_y - 0.5);
+	triangle.max_y = Math::floor(max_y - 0.5);
+	int first_column = Math::ceil(min_x - 0.5);
+	int last_column = Math::floor(max_x - 0.5);
+
+	if (triangle.min_y > triangle.max_y || first_column > last_column) {
+		return; // Off screen, or not covering any pixel center.
+	}
+
+	for (int i = 0; i < 3; i++) {
+		int j = (i + 1) % 3;
+		double a = y[i] - y[j];
+		double b = x[j] - x[i];
+		triangle.edges[i][0] = a;
+		triangle.edges[i][1] = b;
+		triangle.edges[i][2] = -(a * x[i] + b * y[i]);
+	}
+
+	_setup_plane(triangle.depth_over_w, depth_over_w, x, y, area);
+	_setup_plane(triangle.one_over_w, one_over_w, x, y, area);
+
+	LocalVector<Triangle> &triangles = thread_triangles[p_thread];
+	uint32_t index = triangles.size();
+	triangles.push_back(triangle);
+
+	uint32_t tile_count = tile_grid_size.x * tile_grid_size.y;
+	LocalVector<uint32_t> *bins = &thread_bins[p_thread * tile_count];
+
+	int tile_max_x = MIN(last_column / TILE_SIZE, tile_grid_size.x - 1);
+	int tile_max_y = MIN(triangle.max_y / TILE_SIZE, tile_grid_size.y - 1);
+	for (int tile_y = triangle.min_y / TILE_SIZE; tile_y <= tile_max_y; tile_y++) {
+		for (int tile_x = first_column / TILE_SIZE; tile_x <= tile_max_x; tile_x++) {
+			bins[tile_y * tile_grid_size.x + tile_x].push_back(index);
+		}
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_rasterize_tile_threaded(uint32_t p_tile, void *p_userdata) {
+	const Size2i &buffer_size = sizes[0];
+
+	Rect2i tile;
+	tile.position = Point2i(p_tile % tile_grid_size.x, p_tile / tile_grid_size.x) * TILE_SIZE;
+	tile.size = (buffer_size - tile.position).min(Size2i(TILE_SIZE, TILE_SIZE));
+
+	for (int y = tile.position.y; y < tile.position.y + tile.size.y; y++) {
+		float *row = &mips[0][y * buffer_size.x];
+		for (int x = tile.position.x; x < tile.position.x + tile.size.x; x++) {
+			row[x] = FLT_MAX;
+		}
+	}
+
+	uint32_t tile_count = tile_grid_size.x * tile_grid_size.y;
+	for (uint32_t i = 0; i < thread_count; i++) {
+		const LocalVector<Triangle> &triangles = thread_triangles[i];
+		for (uint32_t index : thread_bins[i * tile_count + p_tile]) {
+			_rasterize_triangle(triangles[index], tile);
+		}
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_rasterize_triangle(const Triangle &p_triangle, const Rect2i &p_tile) {
+	const Size2i &buffer_size = sizes[0];
+
+	int first_row = MAX(p_triangle.min_y, p_tile.position.y);
+	int last_row = MIN(p_triangle.max_y, p_tile.position.y + p_tile.size.y - 1);
+
+	for (int y = first_row; y <= last_row; y++) {
+		double center_y = y + 0.5;
+
+		// Find the span of pixel centers inside all three edges, so the loop below doesn't need any per-pixel masks.
+		double span_begin = p_tile.position.x + 0.5;
+		double span_end = p_tile.position.x + p_tile.size.x - 0.5;
+		bool empty = false;
+
+		for (int i = 0; i < 3; i++) {
+			double a = p_triangle.edges[i][0];
+			double value = p_triangle.edges[i][1] * center_y + p_triangle.edges[i][2];
+			if (a > 0) {
+				span_begin = MAX(span_begin, -value / a);
+			} else if (a < 0) {
+				span_end = MIN(span_end, -value / a);
+			} else if (value < 0) {
+				empty = true;
+				break;
+			}
+		}
+
+		if (empty || span_begin > span_end) {
+			continue;
+		}
+
+		int first_column = Math::ceil(span_begin - 0.5);
+		int last_column = Math::floor(span_end - 0.5);
+		if (first_column > last_column) {
+			continue;
+		}
+
+		double first_center_x = first_column + 0.5;
+		float depth_over_w = p_triangle.depth_over_w[0] * first_center_x + p_triangle.depth_over_w[1] * center_y + p_triangle.depth_over_w[2];
+		float one_over_w = p_triangle.one_over_w[0] * first_center_x + p_triangle.one_over_w[1] * center_y + p_triangle.one_over_w[2];
+		float depth_over_w_step = p_triangle.depth_over_w[0];
+		float one_over_w_step = p_triangle.one_over_w[0];
+
+		float *row = &mips[0][y * buffer_size.x + first_column];
+		int count = last_column - first_column + 1;
+
+		// Branchless so the compiler can vectorize it.
+		for (int x = 0; x < count; x++) {
+			float depth = (depth_over_w + depth_over_w_step * x) / (one_over_w + one_over_w_step * x);
+			row[x] = MIN(row[x], depth);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////
+
+bool RasterOcclusionCull::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RasterOcclusionCull::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RasterOcclusionCull::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RasterOcclusionCull::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+	ERR_FAIL_COND_MSG(p_indices.size() % 3 != 0, "Occluder index count must be a multiple of 3.");
+
+	const int32_t *indices = p_indices.ptr();
+	for (int i = 0; i < p_indices.size(); i++) {
+		ERR_FAIL_INDEX_MSG(indices[i], p_vertices.size(), "Occluder index is out of bounds.");
+	}
+
+	occluder->vertices = p_vertices;
+	occluder->indices = p_indices;
+
+	for (const InstanceID &E : occluder->users) {
+		Scenario *scenario = scenarios.getptr(E.scenario);
+		ERR_CONTINUE(!scenario);
+		scenario->dirty_instances.insert(E.instance);
+		scenario->dirty = true;
+	}
+}
+
+void RasterOcclusionCull::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	// Make sure the instances still using it stop rasterizing its triangles.
+	for (const InstanceID &E : occluder->users) {
+		Scenario *scenario = scenarios.getptr(E.scenario);
+		if (scenario) {
+			scenario->dirty_instances.insert(E.instance);
+			scenario->dirty = true;
+		}
+	}
+
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_scenario(RID p_scenario) {
+	ERR_FAIL_COND(scenarios.has(p_scenario));
+	scenarios[p_scenario] = Scenario();
+}
+
+void RasterOcclusionCull::remove_scenario(RID p_scenario) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios.erase(p_scenario);
+}
+
+void RasterOcclusionCull::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	if (!scenario->instances.has(p_instance)) {
+		scenario->instances[p_instance] = OccluderInstance();
+	}
+
+	OccluderInstance &instance = scenario->instances[p_instance];
+
+	bool changed = false;
+
+	if (instance.occluder != p_occluder) {
+		Occluder *old_occluder = occluder_owner.get_or_null(instance.occluder);
+		if (old_occluder) {
+			old_occluder->users.erase(InstanceID(p_scenario, p_instance));
+		}
+
+		instance.occluder = p_occluder;
+
+		if (p_occluder.is_valid()) {
+			Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+			ERR_FAIL_NULL(occluder);
+			occluder->users.insert(InstanceID(p_scenario, p_instance));
+		}
+		changed = true;
+	}
+
+	if (instance.xform != p_xform) {
+		instance.xform = p_xform;
+		changed = true;
+	}
+
+	if (instance.enabled != p_enabled) {
+		instance.enabled = p_enabled;
+		scenario->dirty = true; // The mesh list needs to be rebuilt, but the instance doesn't need update.
+	}
+
+	if (changed) {
+		scenario->dirty_instances.insert(p_instance);
+		scenario->dirty = true;
+	}
+}
+
+void RasterOcclusionCull::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	OccluderInstance *instance = scenario->instances.getptr(p_instance);
+	if (!instance) {
+		return;
+	}
+
+	Occluder *occluder = occluder_owner.get_or_null(instance->occluder);
+	if (occluder) {
+		occluder->users.erase(InstanceID(p_scenario, p_instance));
+	}
+
+	scenario->instances.erase(p_instance);
+	scenario->dirty_instances.erase(p_instance);
+	scenario->dirty = true;
+}
+
+void RasterOcclusionCull::_update_scenario(Scenario &p_scenario) {
+	if (!p_scenario.dirty) {
+		return;
+	}
+
+	for (const RID &instance_rid : p_scenario.dirty_instances) {
+		OccluderInstance *instance = p_scenario.instances.getptr(instance_rid);
+		if (!instance) {
+			continue;
+		}
+
+		Occluder *occluder = occluder_owner.get_or_null(instance->occluder);
+		if (!occluder) {
+			instance->xformed_vertices.clear();
+			instance->indices.clear();
+			continue;
+		}
+
+		int vertex_count = occluder->vertices.size();
+		const Vector3 *vertices = occluder->vertices.ptr();
+		instance->xformed_vertices.resize(vertex_count);
+		for (int i = 0; i < vertex_count; i++) {
+			instance->xformed_vertices[i] = instance->xform.xform(vertices[i]);
+		}
+
+		instance->indices.resize(occluder->indices.size());
+		memcpy(instance->indices.ptr(), occluder->indices.ptr(), occluder->indices.size() * sizeof(int32_t));
+	}
+	p_scenario.dirty_instances.clear();
+
+	p_scenario.meshes.clear();
+	for (const KeyValue<RID, OccluderInstance> &E : p_scenario.instances) {
+		if (!E.value.enabled || E.value.indices.is_empty()) {
+			continue;
+		}
+
+		RasterHZBuffer::Mesh mesh;
+		mesh.vertices = E.value.xformed_vertices.ptr();
+		mesh.indices = E.value.indices.ptr();
+		mesh.index_count = E.value.indices.size();
+		p_scenario.meshes.push_back(mesh);
+	}
+
+	p_scenario.dirty = false;
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = RasterHZBuffer();
+}
+
+void RasterOcclusionCull::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RasterOcclusionCull::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RasterOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+void RasterOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	RasterHZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer || buffer->is_empty()) {
+		return;
+	}
+
+	Scenario *scenario = scenarios.getptr(buffer->scenario_rid);
+	if (!scenario) {
+		return;
+	}
+
+	_update_scenario(*scenario);
+
+	// Orthogonal cameras need no special handling, as the projection already has w = 1.
+	buffer->rasterize(scenario->meshes.ptr(), scenario->meshes.size(), p_cam_transform, p_cam_projection);
+}
+
+RendererSceneOcclusionCull::HZBuffer *RasterOcclusionCull::buffer_get_ptr(RID p_buffer) {
+	return buffers.getptr(p_buffer);
+}
+
+RID RasterOcclusionCull::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
@@ -407,7 +407,7 @@ _FORCE_INLINE_ static uint32_t _indices_to_primitives(RS::PrimitiveType p_primit
 	return (p_indices - subtractor[p_primitive]) / divisor[p_primitive];
 }
 
-void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used, const Point2 &p_offset, RenderingMethod::RenderInfo *r_render_info) {
+void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used, const Point2 &p_offset, bool p_batchable, RenderingMethod::RenderInfo *r_render_info) {
 	//create an empty push constant
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
@@ -447,8 +447,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 	push_constant.color_texture_pixel_size[0] = 0;
 	push_constant.color_texture_pixel_size[1] = 0;
 
-	push_constant.pad[0] = 0;
-	push_constant.pad[1] = 0;
+	push_constant.instance_offset = 0;
+	push_constant.pad = 0;
 
 	push_constant.lights[0] = 0;
 	push_constant.lights[1] = 0;
@@ -499,6 +499,13 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 			continue;
 		}
 
+		bool batched = p_batchable && c->type == Item::Command::TYPE_RECT && _is_rect_batchable(static_cast<const Item::CommandRect *>(c));
+		if (!batched && state.batch.instance_count && c->type != Item::Command::TYPE_TRANSFORM && c->type != Item::Command::TYPE_ANIMATION_SLICE) {
+			// Anything else that draws or changes state must come after the pending rects.
+			_flush_batch(p_draw_list, p_framebuffer_format, r_render_info);
+			last_texture = RID();
+		}
+
 		push_constant.flags = base_flags | (push_constant.flags & (FLAGS_DEFAULT_NORMAL_MAP_USED | FLAGS_DEFAULT_SPECULAR_MAP_USED)); // Reset on each command for safety, keep canvastexture binding config.
 
 		switch (c->type) {
@@ -509,6 +516,55 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					current_repeat = RenderingServer::CanvasItemTextureRepeat::CANVAS_ITEM_TEXTURE_REPEAT_ENABLED;
 				}
 
+				if (batched) {
+					// Instance data was written by _prepare_batches(), only the batch state is checked here.
+					uint32_t flags = base_flags;
+					bool src_rect_in_pixels = false;
+					float msdf[2] = { 0, 0 };
+
+					if (rect->texture.is_valid()) {
+						src_rect_in_pixels = rect->flags & CANVAS_RECT_REGION;
+						if (rect->flags & CANVAS_RECT_FLIP_H) {
+							flags |= FLAGS_FLIP_H;
+						}
+						if (rect->flags & CANVAS_RECT_FLIP_V) {
+							flags |= FLAGS_FLIP_V;
+						}
+						if (rect->flags & CANVAS_RECT_TRANSPOSE) {
+							flags |= FLAGS_TRANSPOSE_RECT;
+						}
+					}
+
+					if (rect->flags & CANVAS_RECT_MSDF) {
+						flags |= FLAGS_USE_MSDF;
+						msdf[0] = rect->px_range;
+						msdf[1] = rect->outline;
+					}
+
+					State::Batch &batch = state.batch;
+					if (batch.instance_count == 0 || batch.texture != rect->texture || batch.filter != current_filter || batch.repeat != current_repeat || batch.flags != flags || batch.src_rect_in_pixels != src_rect_in_pixels || batch.msdf[0] != msdf[0] || batch.msdf[1] != msdf[1]) {
+						_flush_batch(p_draw_list, p_framebuffer_format, r_render_info);
+
+						batch.texture = rect->texture;
+						batch.filter = current_filter;
+						batch.repeat = current_repeat;
+						batch.flags = flags;
+						batch.src_rect_in_pixels = src_rect_in_pixels;
+						batch.msdf[0] = msdf[0];
+						batch.msdf[1] = msdf[1];
+						batch.instance_offset = state.batch_instance_index;
+					}
+
+					batch.instance_count++;
+					state.batch_instance_index++;
+
+					if (r_render_info) {
+						r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
+						r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += 2;
+					}
+					break;
+				}
+
 				//bind pipeline
 				if (rect->flags & CANVAS_RECT_LCD) {
 					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD_LCD_BLEND].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
@@ -931,6 +987,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					push_constant.dst_rect[j] = 0;
 					push_constant.ninepatch_margins[j] = 0;
 				}
+				push_constant.instance_offset = 0; // May alias primitive colors from a previous command.
+				push_constant.pad = 0;
 
 				for (uint32_t j = 0; j < surf_count; j++) {
 					void *surface = mesh_storage->mesh_get_surface(mesh, j);
@@ -1009,6 +1067,9 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 	}
 #ifdef DEBUG_ENABLED
 	if (debug_redraw && p_item->debug_redraw_time > 0.0) {
+		_flush_batch(p_draw_list, p_framebuffer_format, r_render_info);
+		last_texture = RID();
+
 		Color dc = debug_redraw_color;
 		dc.a *= p_item->debug_redraw_time / debug_redraw_time;
 
@@ -1148,6 +1209,206 @@ RID RendererCanvasRenderRD::_create_base_uniform_set(RID p_to_render_target, boo
 	return uniform_set;
 }
 
+RID RendererCanvasRenderRD::_get_item_material(const Item *p_item) const {
+	RID material = p_item->material_owner == nullptr ? p_item->material : p_item->material_owner->material;
+
+	if (p_item->use_canvas_group) {
+		if (p_item->canvas_group->mode == RS::CANVAS_GROUP_MODE_CLIP_AND_DRAW) {
+			material = default_clip_children_material;
+		} else {
+			if (material.is_null()) {
+				if (p_item->canvas_group->mode == RS::CANVAS_GROUP_MODE_CLIP_ONLY) {
+					material = default_clip_children_material;
+				} else {
+					material = default_canvas_group_material;
+				}
+			}
+		}
+	}
+
+	return material;
+}
+
+bool RendererCanvasRenderRD::_is_item_batchable(const Item *p_item, RID p_material, Light *p_lights) const {
+	if (!state.batching_enabled) {
+		return false;
+	}
+
+	// Custom shaders may rely on per-item MODEL_MATRIX or INSTANCE_CUSTOM, and lit items need the
+	// world transform and light indices in the push constant, so only plain unlit items are batched.
+	if (p_material.is_valid() || p_item->repeat_size.x || p_item->repeat_size.y || using_directional_lights) {
+		return false;
+	}
+
+	const Light *light = p_lights;
+	while (light) {
+		if (light->render_index_cache >= 0 && p_item->light_mask & light->item_mask && p_item->z_final >= light->z_min && p_item->z_final <= light->z_max && p_item->global_rect_cache.intersects_transformed(light->xform_cache, light->rect_cache)) {
+			return false;
+		}
+		light = light->next_ptr;
+	}
+
+	return true;
+}
+
+void RendererCanvasRenderRD::_prepare_batches(RID p_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights) {
+	bool use_linear_colors = RendererRD::TextureStorage::get_singleton()->render_target_is_using_hdr(p_render_target);
+
+	state.batch_instances.clear();
+	state.batchable_items.resize(p_item_count);
+	state.batch_instance_index = 0;
+	state.batch.instance_count = 0;
+
+	for (int i = 0; i < p_item_count; i++) {
+		const Item *ci = items[i];
+		state.batchable_items[i] = _is_item_batchable(ci, _get_item_material(ci), p_lights);
+		if (!state.batchable_items[i]) {
+			continue;
+		}
+
+		// Must visit commands exactly like _render_item() does, which consumes these instances in order.
+		Transform2D base_transform = p_canvas_transform_inverse * ci->final_transform;
+		Transform2D draw_transform;
+		bool skipping = false;
+
+		for (const Item::Command *c = ci->commands; c; c = c->next) {
+			if (skipping && c->type != Item::Command::TYPE_ANIMATION_SLICE) {
+				continue;
+			}
+
+			switch (c->type) {
+				case Item::Command::TYPE_RECT: {
+					const Item::CommandRect *rect = static_cast<const Item::CommandRect *>(c);
+					if (!_is_rect_batchable(rect)) {
+						break;
+					}
+
+					Rect2 dst_rect = rect->rect.abs();
+					Rect2 src_rect = Rect2(0, 0, 1, 1);
+
+					if (rect->texture.is_valid()) {
+						if (rect->flags & CANVAS_RECT_REGION) {
+							src_rect = rect->source;
+						}
+						if (rect->flags & CANVAS_RECT_FLIP_H) {
+							src_rect.size.x *= -1;
+						}
+						if (rect->flags & CANVAS_RECT_FLIP_V) {
+							src_rect.size.y *= -1;
+						}
+					}
+
+					Color modulated = rect->modulate * ci->final_modulate;
+					if (use_linear_colors) {
+						modulated = modulated.srgb_to_linear();
+					}
+
+					State::BatchInstance instance;
+					Transform2D rect_transform(dst_rect.size.width, 0, 0, dst_rect.size.height, dst_rect.position.x, dst_rect.position.y);
+					_update_transform_2d_to_mat2x4(base_transform * draw_transform * rect_transform, instance.world);
+
+					instance.modulation[0] = modulated.r;
+					instance.modulation[1] = modulated.g;
+					instance.modulation[2] = modulated.b;
+					instance.modulation[3] = modulated.a;
+
+					instance.src_rect[0] = src_rect.position.x;
+					instance.src_rect[1] = src_rect.position.y;
+					instance.src_rect[2] = src_rect.size.width;
+					instance.src_rect[3] = src_rect.size.height;
+
+					state.batch_instances.push_back(instance);
+				} break;
+				case Item::Command::TYPE_TRANSFORM: {
+					const Item::CommandTransform *transform = static_cast<const Item::CommandTransform *>(c);
+					draw_transform = transform->xform;
+				} break;
+				case Item::Command::TYPE_ANIMATION_SLICE: {
+					const Item::CommandAnimationSlice *as = static_cast<const Item::CommandAnimationSlice *>(c);
+					double current_time = RendererCompositorRD::get_singleton()->get_total_time();
+					double local_time = Math::fposmod(current_time - as->offset, as->animation_length);
+					skipping = !(local_time >= as->slice_begin && local_time < as->slice_end);
+				} break;
+				default: {
+				}
+			}
+		}
+	}
+
+	uint32_t instance_count = state.batch_instances.size();
+	if (instance_count == 0) {
+		return;
+	}
+
+	if (instance_count > state.batch_instance_capacity) {
+		if (state.batch_instance_buffer.is_valid()) {
+			RD::get_singleton()->free(state.batch_instance_buffer); // Also frees the uniform set.
+		}
+
+		state.batch_instance_capacity = next_power_of_2(instance_count);
+		state.batch_instance_buffer = RD::get_singleton()->storage_buffer_create(state.batch_instance_capacity * sizeof(State::BatchInstance));
+
+		Vector<RD::Uniform> uniforms;
+		RD::Uniform u;
+		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+		u.binding = 0;
+		u.append_id(state.batch_instance_buffer);
+		uniforms.push_back(u);
+
+		state.batch_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shader.default_version_rd_shader, TRANSFORMS_UNIFORM_SET);
+	}
+
+	RD::get_singleton()->buffer_update(state.batch_instance_buffer, 0, instance_count * sizeof(State::BatchInstance), state.batch_instances.ptr());
+}
+
+void RendererCanvasRenderRD::_flush_batch(RD::DrawListID p_draw_list, RD::FramebufferFormatID p_framebuffer_format, RenderingMethod::RenderInfo *r_render_info) {
+	State::Batch &batch = state.batch;
+	if (batch.instance_count == 0) {
+		return;
+	}
+
+	RID pipeline = shader.pipeline_variants.variants[PIPELINE_LIGHT_MODE_DISABLED][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
+	RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, state.batch_uniform_set, TRANSFORMS_UNIFORM_SET);
+
+	// Transform, color and source rect come from the instance, see canvas.glsl.
+	PushConstant push_constant;
+	_update_transform_2d_to_mat2x3(Transform2D(), push_constant.world);
+	push_constant.flags = batch.flags | 1 | FLAGS_INSTANCING_HAS_COLORS | FLAGS_INSTANCING_HAS_CUSTOM_DATA | FLAGS_INSTANCING_BATCHED_RECT;
+	push_constant.specular_shininess = 0;
+
+	for (int i = 0; i < 4; i++) {
+		push_constant.modulation[i] = 1;
+		push_constant.msdf[i] = 0;
+		push_constant.src_rect[i] = 0;
+		push_constant.dst_rect[i] = 0;
+		push_constant.lights[i] = 0;
+	}
+	push_constant.msdf[0] = batch.msdf[0]; // Pixel range.
+	push_constant.msdf[1] = batch.msdf[1]; // Outline size.
+	push_constant.instance_offset = batch.instance_offset;
+	push_constant.pad = 0;
+
+	RID last_texture;
+	Size2 texpixel_size;
+	_bind_canvas_texture(p_draw_list, batch.texture, batch.filter, batch.repeat, last_texture, push_constant, texpixel_size, bool(batch.flags & FLAGS_USE_MSDF));
+
+	// Scale applied to the per-instance source rect.
+	push_constant.src_rect[2] = batch.src_rect_in_pixels ? texpixel_size.x : 1.0;
+	push_constant.src_rect[3] = batch.src_rect_in_pixels ? texpixel_size.y : 1.0;
+
+	RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
+	RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
+	RD::get_singleton()->draw_list_draw(p_draw_list, true, batch.instance_count);
+
+	if (r_render_info) {
+		r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
+		r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_BATCHES_IN_FRAME]++;
+	}
+
+	batch.instance_count = 0;
+}
+
 void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer, RenderingMethod::RenderInfo *r_render_info) {
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
@@ -1183,6 +1444,9 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 
 	RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(framebuffer);
 
+	// Buffers can't be updated while a draw list is being recorded, so batched instances are uploaded first.
+	_prepare_batches(p_to_render_target, p_item_count, canvas_transform_inverse, p_lights);
+
 	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, clear ? RD::INITIAL_ACTION_CLEAR : RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_DISCARD, clear_colors);
 
 	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, fb_uniform_set, BASE_UNIFORM_SET);
@@ -1194,8 +1458,14 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 
 	for (int i = 0; i < p_item_count; i++) {
 		Item *ci = items[i];
+		bool batchable = state.batchable_items[i];
+
+		if (!batchable) {
+			_flush_batch(draw_list, fb_format, r_render_info);
+		}
 
 		if (current_clip != ci->final_clip_owner) {
+			_flush_batch(draw_list, fb_format, r_render_info);
 			current_clip = ci->final_clip_owner;
 
 			//setup clip
@@ -1207,21 +1477,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 			}
 		}
 
-		RID material = ci->material_owner == nullptr ? ci->material : ci->material_owner->material;
-
-		if (ci->use_canvas_group) {
-			if (ci->canvas_group->mode == RS::CANVAS_GROUP_MODE_CLIP_AND_DRAW) {
-				material = default_clip_children_material;
-			} else {
-				if (material.is_null()) {
-					if (ci->canvas_group->mode == RS::CANVAS_GROUP_MODE_CLIP_ONLY) {
-						material = default_clip_children_material;
-					} else {
-						material = default_canvas_group_material;
-					}
-				}
-			}
-		}
+		RID material = _get_item_material(ci);
 
 		if (material != prev_material) {
 			CanvasMaterialData *material_data = nullptr;
@@ -1247,7 +1503,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		}
 
 		if (!ci->repeat_size.x && !ci->repeat_size.y) {
-			_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used, Point2(), r_render_info);
+			_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used, Point2(), batchable, r_render_info);
 		} else {
 			Point2 start_pos = ci->repeat_size * -(ci->repeat_times / 2);
 			Point2 end_pos = ci->repeat_size * ci->repeat_times + ci->repeat_size + start_pos;
@@ -1255,7 +1511,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 
 			do {
 				do {
-					_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used, pos, r_render_info);
+					_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used, pos, false, r_render_info);
 					pos.y += ci->repeat_size.y;
 				} while (pos.y < end_pos.y);
 
@@ -1267,6 +1523,8 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		prev_material = material;
 	}
 
+	_flush_batch(draw_list, fb_format, r_render_info);
+
 	RD::get_singleton()->draw_list_end();
 }
 
@@ -2780,6 +3038,7 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 	texture_storage->canvas_texture_initialize(default_canvas_texture);
 
 	state.shadow_texture_size = GLOBAL_GET("rendering/2d/shadow_atlas/size");
+	state.batching_enabled = GLOBAL_GET("rendering/2d/batching/batch_rects");
 
 	//create functions for shader and material
 	material_storage->shader_set_data_request_function(RendererRD::MaterialStorage::SHADER_TYPE_2D, _create_shader_funcs);
@@ -2905,6 +3164,10 @@ RendererCanvasRenderRD::~RendererCanvasRenderRD() {
 
 		memdelete_arr(state.light_uniforms);
 		RD::get_singleton()->free(state.lights_uniform_buffer);
+
+		if (state.batch_instance_buffer.is_valid()) {
+			RD::get_singleton()->free(state.batch_instance_buffer);
+		}
 	}
 
 	//shadow rendering
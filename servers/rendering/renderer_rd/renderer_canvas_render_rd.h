@@ -79,6 +79,7 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 		FLAGS_NINEPACH_DRAW_CENTER = (1 << 12),
 		FLAGS_USING_PARTICLES = (1 << 13),
+		FLAGS_INSTANCING_BATCHED_RECT = (1 << 14),
 
 		FLAGS_USE_SKELETON = (1 << 15),
 		FLAGS_NINEPATCH_H_MODE_SHIFT = 16,
@@ -370,6 +371,33 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 		RID default_transforms_uniform_set;
 
+		// Consecutive rects sharing texture and state are drawn as one instanced quad.
+		struct BatchInstance {
+			float world[8];
+			float modulation[4];
+			float src_rect[4]; // Normalized, or in pixels for texture regions.
+		};
+
+		struct Batch {
+			RID texture;
+			RS::CanvasItemTextureFilter filter = RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT;
+			RS::CanvasItemTextureRepeat repeat = RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT;
+			uint32_t flags = 0;
+			bool src_rect_in_pixels = false;
+			float msdf[2] = {};
+			uint32_t instance_offset = 0;
+			uint32_t instance_count = 0;
+		};
+
+		bool batching_enabled = false;
+		LocalVector<BatchInstance> batch_instances;
+		LocalVector<bool> batchable_items;
+		RID batch_instance_buffer;
+		RID batch_uniform_set;
+		uint32_t batch_instance_capacity = 0;
+		uint32_t batch_instance_index = 0;
+		Batch batch;
+
 		uint32_t max_lights_per_render;
 		uint32_t max_lights_per_item;
 
@@ -391,7 +419,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 				};
 				float dst_rect[4];
 				float src_rect[4];
-				float pad[2];
+				uint32_t instance_offset;
+				float pad;
 			};
 			//primitive
 			struct {
@@ -423,8 +452,14 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 	Color debug_redraw_color;
 	double debug_redraw_time = 1.0;
 
+	_FORCE_INLINE_ RID _get_item_material(const Item *p_item) const;
+	bool _is_item_batchable(const Item *p_item, RID p_material, Light *p_lights) const;
+	_FORCE_INLINE_ static bool _is_rect_batchable(const Item::CommandRect *p_rect) { return !(p_rect->flags & (CANVAS_RECT_LCD | CANVAS_RECT_CLIP_UV)); }
+	void _prepare_batches(RID p_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights);
+	void _flush_batch(RenderingDevice::DrawListID p_draw_list, RenderingDevice::FramebufferFormatID p_framebuffer_format, RenderingMethod::RenderInfo *r_render_info);
+
 	inline void _bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data = false); //recursive, so regular inline used instead.
-	void _render_item(RenderingDevice::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used, const Point2 &p_offset, RenderingMethod::RenderInfo *r_render_info = nullptr);
+	void _render_item(RenderingDevice::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used, const Point2 &p_offset, bool p_batchable, RenderingMethod::RenderInfo *r_render_info = nullptr);
 	void _render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer = false, RenderingMethod::RenderInfo *r_render_info = nullptr);
 
 	_FORCE_INLINE_ void _update_transform_2d_to_mat2x4(const Transform2D &p_transform, float *p_mat2x4);
@@ -175,6 +175,12 @@ void main() {
 			}
 
 			uint offset = stride * gl_InstanceIndex;
+#if !defined(USE_ATTRIBUTES) && !defined(USE_PRIMITIVE)
+			if (bool(draw_data.flags & FLAGS_INSTANCING_BATCHED_RECT)) {
+				// Batches share one instance buffer, each draw starts at its own offset.
+				offset += stride * draw_data.instance_offset;
+			}
+#endif
 
 			mat4 matrix = mat4(transforms.data[offset + 0], transforms.data[offset + 1], vec4(0.0, 0.0, 1.0, 0.0), vec4(0.0, 0.0, 0.0, 1.0));
 			offset += 2;
@@ -188,6 +194,16 @@ void main() {
 				instance_custom = transforms.data[offset];
 			}
 
+#if !defined(USE_ATTRIBUTES) && !defined(USE_PRIMITIVE)
+			if (bool(draw_data.flags & FLAGS_INSTANCING_BATCHED_RECT)) {
+				// Batched rects keep their source rect in the custom data, scaled to UV by src_rect.zw.
+				vec4 src_rect = instance_custom * draw_data.src_rect.zwzw;
+				uv = src_rect.xy + abs(src_rect.zw) * ((draw_data.flags & FLAGS_TRANSPOSE_RECT) != 0 ? vertex_base.yx : vertex_base.xy);
+				vertex = mix(vertex_base, vec2(1.0, 1.0) - vertex_base, lessThan(src_rect.zw, vec2(0.0, 0.0)));
+				instance_custom = vec4(0.0);
+			}
+#endif
+
 			matrix = transpose(matrix);
 			model_matrix = model_matrix * matrix;
 		}
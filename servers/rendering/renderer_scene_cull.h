@@ -123,7 +123,7 @@ public:
 
 	/* VISIBILITY NOTIFIER API */
 
-	RendererSceneOcclusionCull *dummy_occlusion_culling = nullptr;
+	RendererSceneOcclusionCull *default_occlusion_culling = nullptr;
 
 	/* SCENARIO API */
 
@@ -248,6 +248,42 @@ public:
 		}
 	};
 
+	struct InstanceBoundsBlock {
+		// Same bounds as InstanceBounds for SIZE consecutive instances, stored per component
+		// so the camera frustum test runs over all of them at once and can be vectorized.
+
+		static constexpr uint32_t SIZE = 8;
+
+		real_t bounds[6][SIZE] = {};
+
+		_ALWAYS_INLINE_ void set(uint32_t p_lane, const InstanceBounds &p_bounds) {
+			for (uint32_t i = 0; i < 6; i++) {
+				bounds[i][p_lane] = p_bounds.bounds[i];
+			}
+		}
+		// Returns one bit per instance, set when InstanceBounds::in_frustum() would return true.
+		_ALWAYS_INLINE_ uint32_t in_frustum(const Frustum &p_frustum) const {
+			uint32_t outside[SIZE] = {};
+
+			for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+				const Plane &plane = p_frustum.planes_ptr[i];
+				const real_t *x = bounds[p_frustum.plane_signs_ptr[i].signs[0]];
+				const real_t *y = bounds[p_frustum.plane_signs_ptr[i].signs[1]];
+				const real_t *z = bounds[p_frustum.plane_signs_ptr[i].signs[2]];
+
+				for (uint32_t j = 0; j < SIZE; j++) {
+					outside[j] |= (plane.normal.x * x[j] + plane.normal.y * y[j] + plane.normal.z * z[j] - plane.d) >= 0.0;
+				}
+			}
+
+			uint32_t mask = 0;
+			for (uint32_t j = 0; j < SIZE; j++) {
+				mask |= (outside[j] ^ 1) << j;
+			}
+			return mask;
+		}
+	};
+
 	struct InstanceVisibilityNotifierData;
 
 	struct InstanceData {
@@ -318,6 +354,7 @@ public:
 	};
 
 	PagedArrayPool<InstanceBounds> instance_aabb_page_pool;
+	PagedArrayPool<InstanceBoundsBlock> instance_aabb_block_page_pool;
 	PagedArrayPool<InstanceData> instance_data_page_pool;
 	PagedArrayPool<InstanceVisibilityData> instance_visibility_data_page_pool;
 
@@ -347,9 +384,29 @@ public:
 		LocalVector<RID> dynamic_lights;
 
 		PagedArray<InstanceBounds> instance_aabbs;
+		PagedArray<InstanceBoundsBlock> instance_aabb_blocks; // Mirrors instance_aabbs for culling.
 		PagedArray<InstanceData> instance_data;
 		VisibilityArray instance_visibility;
 
+		_FORCE_INLINE_ void push_instance_bounds(const InstanceBounds &p_bounds) {
+			uint64_t index = instance_aabbs.size();
+			instance_aabbs.push_back(p_bounds);
+			if (index % InstanceBoundsBlock::SIZE == 0) {
+				instance_aabb_blocks.push_back(InstanceBoundsBlock());
+			}
+			instance_aabb_blocks[index / InstanceBoundsBlock::SIZE].set(index % InstanceBoundsBlock::SIZE, p_bounds);
+		}
+		_FORCE_INLINE_ void set_instance_bounds(uint64_t p_index, const InstanceBounds &p_bounds) {
+			instance_aabbs[p_index] = p_bounds;
+			instance_aabb_blocks[p_index / InstanceBoundsBlock::SIZE].set(p_index % InstanceBoundsBlock::SIZE, p_bounds);
+		}
+		_FORCE_INLINE_ void pop_instance_bounds() {
+			instance_aabbs.pop_back();
+			if (instance_aabbs.size() % InstanceBoundsBlock::SIZE == 0) {
+				instance_aabb_blocks.pop_back();
+			}
+		}
+
 		Scenario() {
 			indexers[INDEXER_GEOMETRY].set_index(INDEXER_GEOMETRY);
 			indexers[INDEXER_VOLUMES].set_index(INDEXER_VOLUMES);
@@ -690,6 +747,23 @@ public:
 	SpinLock visible_notifier_list_lock;
 	SelfList<InstanceVisibilityNotifierData>::List visible_notifier_list;
 
+	// Shadow casters found for one pass of a positional light, reused while the casters don't change.
+	struct ShadowCasterCache {
+		uint64_t caster_version = UINT64_MAX;
+		uint32_t visible_layers = 0;
+		LocalVector<RenderGeometryInstance *> instances;
+		LocalVector<RID> mesh_instances;
+		bool animated_material_found = false;
+
+		bool is_valid(uint64_t p_caster_version, uint32_t p_visible_layers) const { return caster_version == p_caster_version && visible_layers == p_visible_layers; }
+		void reset() {
+			caster_version = UINT64_MAX;
+			instances.reset();
+			mesh_instances.reset();
+			animated_material_found = false;
+		}
+	};
+
 	struct InstanceLightData : public InstanceBaseData {
 		RID instance;
 		uint64_t last_version;
@@ -705,6 +779,11 @@ public:
 		RS::LightBakeMode bake_mode;
 		uint32_t max_sdfgi_cascade = 2;
 
+		// Bumped whenever a caster within range (or the light itself) changes, invalidating the cached casters.
+		uint64_t caster_version = 0;
+		bool shadow_caster_cache = false;
+		ShadowCasterCache shadow_caster_caches[6]; // One per pass, cube shadows use all six.
+
 	private:
 		// Instead of a single dirty flag, we maintain a count
 		// so that we can detect lights that are being made dirty
@@ -717,7 +796,14 @@ public:
 
 	public:
 		bool is_shadow_dirty() const { return shadow_dirty_count != 0; }
-		void make_shadow_dirty() { shadow_dirty_count = light_intersects_multiple_cameras ? 1 : 2; }
+		// Pass false when the shadow only needs to be redrawn and the set of casters is unchanged.
+		void make_shadow_dirty(bool p_casters_changed = true) {
+			if (p_casters_changed) {
+				caster_version++;
+			}
+			// Cached casters must not depend on the camera, so always do full updates when caching.
+			shadow_dirty_count = (light_intersects_multiple_cameras || shadow_caster_cache) ? 1 : 2;
+		}
 		void detect_light_intersects_multiple_cameras(uint32_t p_frame_id) {
 			// We need to detect the case where shadow updates are occurring
 			// more than once per frame. In this case, we need to turn off
@@ -879,7 +965,6 @@ public:
 	PagedArrayPool<RID> rid_cull_page_pool;
 
 	PagedArray<Instance *> instance_cull_result;
-	PagedArray<Instance *> instance_shadow_cull_result;
 
 	struct InstanceCullResult {
 		PagedArray<RenderGeometryInstance *> geometry_instances;
@@ -1007,6 +1092,27 @@ public:
 	RendererSceneRender::RenderShadowData render_shadow_data[MAX_UPDATE_SHADOWS];
 	uint32_t max_shadows_used = 0;
 
+	// Caster cull of one positional light shadow pass, run on worker threads.
+	struct ShadowCullTask {
+		InstanceLightData *light = nullptr;
+		Scenario *scenario = nullptr;
+		Vector<Plane> planes;
+		LocalVector<Plane> caster_cull_planes;
+		uint32_t visible_layers = 0;
+		uint32_t shadow_index = 0;
+
+		// Where to store the culled casters, or reuse them from when cache_hit is set.
+		ShadowCasterCache *cache = nullptr;
+		bool cache_hit = false;
+
+		PagedArray<Instance *> instances;
+		PagedArray<RID> mesh_instances;
+		bool animated_material_found = false;
+	};
+
+	ShadowCullTask shadow_cull_tasks[MAX_UPDATE_SHADOWS];
+	uint32_t shadow_cull_task_count = 0;
+
 	RendererSceneRender::RenderSDFGIData render_sdfgi_data[SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE];
 	RendererSceneRender::RenderSDFGIUpdateData sdfgi_update_data;
 
@@ -1027,6 +1133,7 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center);
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform);
+	virtual void instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material);
@@ -1076,6 +1183,9 @@ public:
 
 	void _light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect);
 
+	void _add_shadow_cull_task(InstanceLightData *p_light, const Vector<Plane> &p_planes, Scenario *p_scenario, uint32_t p_visible_layers, int p_pass);
+	void _shadow_cull_threaded(uint32_t p_index, ShadowCullTask *p_tasks);
+	void _process_shadow_cull_tasks();
 	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_scren_mesh_lod_threshold, uint32_t p_visible_layers = 0xFFFFFF);
 
 	RID _render_get_environment(RID p_camera, RID p_scenario);
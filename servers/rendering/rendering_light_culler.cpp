@@ -221,6 +221,44 @@ void RenderingLightCuller::cull_regular_light(PagedArray<RendererSceneCull::Inst
 #endif
 }
 
+void RenderingLightCuller::get_regular_light_cull_planes(LocalVector<Plane> &r_planes) const {
+	r_planes.clear();
+
+	// Same early outs as cull_regular_light.
+	if (!data.is_active() || !is_caster_culling_active() || data.out_of_range) {
+		return;
+	}
+
+	r_planes.resize(data.regular_cull_planes.num_cull_planes);
+	for (int p = 0; p < data.regular_cull_planes.num_cull_planes; p++) {
+		r_planes[p] = data.regular_cull_planes.cull_planes[p];
+	}
+}
+
+void RenderingLightCuller::cull_regular_light(PagedArray<RendererSceneCull::Instance *> &r_instance_shadow_cull_result, const Plane *p_cull_planes, int p_cull_plane_count) {
+	PagedArray<RendererSceneCull::Instance *> &list = r_instance_shadow_cull_result;
+
+	for (int n = 0; n < (int)list.size(); n++) {
+		const AABB &bb = list[n]->transformed_aabb;
+
+		real_t r_min, r_max;
+		bool show = true;
+
+		for (int p = 0; p < p_cull_plane_count; p++) {
+			bb.project_range_in_plane(p_cull_planes[p], r_min, r_max);
+			if (r_min > 0.0f) {
+				show = false;
+				break;
+			}
+		}
+
+		if (!show) {
+			list.remove_at_unordered(n);
+			n--;
+		}
+	}
+}
+
 void RenderingLightCuller::LightCullPlanes::add_cull_plane(const Plane &p) {
 	ERR_FAIL_COND(num_cull_planes >= MAX_CULL_PLANES);
 	cull_planes[num_cull_planes++] = p;
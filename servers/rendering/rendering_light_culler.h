@@ -140,6 +140,11 @@ public:
 	// Cull according to the regular light planes that were setup in the previous call to prepare_regular_light.
 	void cull_regular_light(PagedArray<RendererSceneCull::Instance *> &r_instance_shadow_cull_result);
 
+	// Copies the planes setup by the previous call to prepare_regular_light, so casters can be culled later
+	// (and from any thread) with the static cull_regular_light. Leaves r_planes empty if nothing should be culled.
+	void get_regular_light_cull_planes(LocalVector<Plane> &r_planes) const;
+	static void cull_regular_light(PagedArray<RendererSceneCull::Instance *> &r_instance_shadow_cull_result, const Plane *p_cull_planes, int p_cull_plane_count);
+
 	// Directional lights are prepared in advance, and can be culled multithreaded chopping and changing between
 	// different directional_light_id.
 	void prepare_directional_light(const RendererSceneCull::Instance *p_instance, int32_t p_directional_light_id);
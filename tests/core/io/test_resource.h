@@ -32,14 +32,45 @@
 #define TEST_RESOURCE_H
 
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/object/message_queue.h"
 #include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
 #include "tests/test_macros.h"
 
+class _TestSharedUserResource : public Resource {
+	GDCLASS(_TestSharedUserResource, Resource);
+
+	Ref<Resource> shared;
+
+	void _shared_changed() { shared_changed_count++; }
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_shared", "shared"), &_TestSharedUserResource::set_shared);
+		ClassDB::bind_method(D_METHOD("get_shared"), &_TestSharedUserResource::get_shared);
+		ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "shared", PROPERTY_HINT_RESOURCE_TYPE, "Resource"), "set_shared", "get_shared");
+	}
+
+public:
+	int shared_changed_count = 0;
+
+	void set_shared(const Ref<Resource> &p_shared) {
+		if (shared.is_valid()) {
+			shared->disconnect_changed(callable_mp(this, &_TestSharedUserResource::_shared_changed));
+		}
+		shared = p_shared;
+		if (shared.is_valid()) {
+			shared->connect_changed(callable_mp(this, &_TestSharedUserResource::_shared_changed));
+		}
+	}
+	Ref<Resource> get_shared() const { return shared; }
+};
+
 namespace TestResource {
 
 TEST_CASE("[Resource] Duplication") {
@@ -112,6 +143,157 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[SceneTree][Resource] Loading binary sub-resources on sub-threads") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	Array children;
+	for (int i = 0; i < 32; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		child->set_meta("value", i * 10);
+		if (i % 4 != 0) {
+			// Chains of dependent sub-resources mixed with independent ones.
+			child->set_meta("previous", children.back());
+		}
+		children.push_back(child);
+	}
+	resource->set_meta("children", children);
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("resource_sub_threads.res");
+	ResourceSaver::save(resource, save_path);
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+	Error err = OK;
+	Ref<Resource> loaded_serial = loader->load(save_path, save_path, &err, false, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(err == OK);
+	Ref<Resource> loaded_threaded = loader->load(save_path, save_path, &err, true, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(err == OK);
+
+	Array serial_children = loaded_serial->get_meta("children");
+	Array threaded_children = loaded_threaded->get_meta("children");
+	REQUIRE(threaded_children.size() == 32);
+	CHECK(loaded_threaded->get_name() == "Root");
+	for (int i = 0; i < 32; i++) {
+		Ref<Resource> serial_child = serial_children[i];
+		Ref<Resource> threaded_child = threaded_children[i];
+		CHECK_MESSAGE(
+				threaded_child->get_name() == serial_child->get_name(),
+				"Sub-resources set on sub-threads should match the ones loaded serially.");
+		CHECK(int(threaded_child->get_meta("value")) == i * 10);
+		if (i % 4 != 0) {
+			CHECK(Ref<Resource>(threaded_child->get_meta("previous")) == Ref<Resource>(threaded_children[i - 1]));
+		} else {
+			CHECK_FALSE(threaded_child->has_meta("previous"));
+		}
+	}
+}
+
+TEST_CASE("[SceneTree][Resource] Loading binary sub-resources connected to a shared one on sub-threads") {
+	GDREGISTER_CLASS(_TestSharedUserResource);
+
+	const int user_count = 64;
+	Ref<Resource> resource = memnew(Resource);
+	Ref<Resource> shared = memnew(Resource);
+	Array users;
+	for (int i = 0; i < user_count; i++) {
+		Ref<_TestSharedUserResource> user = memnew(_TestSharedUserResource);
+		user->set_shared(shared);
+		users.push_back(user);
+	}
+	resource->set_meta("users", users);
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("resource_shared_sub_threads.res");
+	ResourceSaver::save(resource, save_path);
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+	Error err = OK;
+	Ref<Resource> loaded = loader->load(save_path, save_path, &err, true, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(err == OK);
+	// Connections made by setters on helper threads are deferred to the main thread.
+	MessageQueue::get_singleton()->flush();
+
+	Array loaded_users = loaded->get_meta("users");
+	REQUIRE(loaded_users.size() == user_count);
+	Ref<Resource> loaded_shared = Ref<_TestSharedUserResource>(loaded_users[0])->get_shared();
+	REQUIRE(loaded_shared.is_valid());
+
+	List<Object::Connection> connections;
+	loaded_shared->get_signal_connection_list("changed", &connections);
+	CHECK_MESSAGE(connections.size() == user_count, "Every sub-resource should be connected to the shared one once.");
+
+	loaded_shared->emit_changed();
+	for (int i = 0; i < user_count; i++) {
+		Ref<_TestSharedUserResource> user = loaded_users[i];
+		CHECK(user->get_shared() == loaded_shared);
+		CHECK(user->shared_changed_count == 1);
+	}
+}
+
+TEST_CASE("[SceneTree][Resource] Threaded loading of external dependency trees") {
+	const String base_path = OS::get_singleton()->get_cache_path();
+	const String leaf_path = base_path.path_join("resource_prefetch_leaf.res");
+	const String root_path = base_path.path_join("resource_prefetch_root.res");
+	{
+		Ref<Resource> leaf = memnew(Resource);
+		leaf->set_name("Leaf");
+		ResourceSaver::save(leaf, leaf_path);
+		leaf->set_path(leaf_path);
+
+		// Two chains sharing the same leaf, each link saved to its own file.
+		Ref<Resource> root = memnew(Resource);
+		root->set_name("Root");
+		for (int chain = 0; chain < 2; chain++) {
+			Ref<Resource> next = leaf;
+			for (int depth = 0; depth < 4; depth++) {
+				Ref<Resource> link = memnew(Resource);
+				link->set_name(vformat("Link %d-%d", chain, depth));
+				link->set_meta("next", next);
+				// Internal sub-resources, set on sub-threads as well when the link is prefetched.
+				Array parts;
+				for (int part = 0; part < 4; part++) {
+					Ref<Resource> part_resource = memnew(Resource);
+					part_resource->set_name(vformat("Part %d", part));
+					parts.push_back(part_resource);
+				}
+				link->set_meta("parts", parts);
+				const String link_path = base_path.path_join(vformat("resource_prefetch_%d_%d.res", chain, depth));
+				ResourceSaver::save(link, link_path);
+				link->set_path(link_path);
+				next = link;
+			}
+			root->set_meta(vformat("chain_%d", chain), next);
+		}
+		ResourceSaver::save(root, root_path);
+	}
+	ResourceCache::clear_retained();
+	REQUIRE_FALSE(ResourceCache::has(leaf_path));
+
+	REQUIRE(ResourceLoader::load_threaded_request(root_path, "", true) == OK);
+	Ref<Resource> loaded = ResourceLoader::load_threaded_get(root_path);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "Root");
+
+	Ref<Resource> leaves[2];
+	for (int chain = 0; chain < 2; chain++) {
+		Ref<Resource> link = loaded->get_meta(vformat("chain_%d", chain));
+		for (int depth = 3; depth >= 0; depth--) {
+			REQUIRE(link.is_valid());
+			CHECK(link->get_name() == vformat("Link %d-%d", chain, depth));
+			Array parts = link->get_meta("parts");
+			REQUIRE(parts.size() == 4);
+			CHECK(Ref<Resource>(parts[3])->get_name() == "Part 3");
+			link = link->get_meta("next");
+		}
+		leaves[chain] = link;
+	}
+	REQUIRE(leaves[0].is_valid());
+	CHECK(leaves[0]->get_name() == "Leaf");
+	CHECK_MESSAGE(
+			leaves[0] == leaves[1],
+			"Dependencies shared by several branches should be loaded only once.");
+	CHECK_FALSE(leaves[0]->is_built_in());
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -166,6 +348,107 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+TEST_CASE("[Resource] Cache retention budget") {
+	const uint64_t size = Ref<Resource>(memnew(Resource))->estimate_memory_usage();
+	ResourceCache::set_retention_budget(size * 2);
+
+	Ref<Resource> resource_a = memnew(Resource);
+	resource_a->set_path("res://retained_a.tres");
+	ResourceCache::retain(resource_a);
+	Ref<Resource> resource_b = memnew(Resource);
+	resource_b->set_path("res://retained_b.tres");
+	ResourceCache::retain(resource_b);
+	resource_a.unref();
+	resource_b.unref();
+
+	CHECK_MESSAGE(
+			ResourceCache::has("res://retained_a.tres"),
+			"Unreferenced resources within the budget should stay cached.");
+	CHECK(ResourceCache::has("res://retained_b.tres"));
+	CHECK_EQ(ResourceCache::get_retained_resource_count(), 2);
+	CHECK_EQ(ResourceCache::get_retained_memory(), size * 2);
+
+	// Touching A makes B the least recently used one.
+	ResourceCache::retain(ResourceCache::get_ref("res://retained_a.tres"));
+	Ref<Resource> resource_c = memnew(Resource);
+	resource_c->set_path("res://retained_c.tres");
+	ResourceCache::retain(resource_c);
+
+	CHECK(ResourceCache::has("res://retained_a.tres"));
+	CHECK_MESSAGE(
+			!ResourceCache::has("res://retained_b.tres"),
+			"The least recently used resource should be evicted once over budget.");
+	CHECK(ResourceCache::has("res://retained_c.tres"));
+
+	Ref<Resource> resource_a_again = ResourceCache::get_ref("res://retained_a.tres");
+	Ref<Resource> resource_d = memnew(Resource);
+	resource_d->set_path("res://retained_d.tres");
+	ResourceCache::retain(resource_d);
+	CHECK_MESSAGE(
+			ResourceCache::has("res://retained_a.tres"),
+			"Resources still in use should not be evicted.");
+	CHECK_EQ(ResourceCache::get_retained_resource_count(), 3);
+
+	resource_a_again.unref();
+	resource_c.unref();
+	resource_d.unref();
+	ResourceCache::set_retention_budget(0);
+	CHECK_EQ(ResourceCache::get_retained_resource_count(), 0);
+	CHECK_EQ(ResourceCache::get_retained_memory(), 0u);
+	CHECK_FALSE(ResourceCache::has("res://retained_a.tres"));
+	CHECK_FALSE(ResourceCache::has("res://retained_c.tres"));
+}
+
+TEST_CASE("[Resource] Cache retention budget with retained resources referencing each other") {
+	const uint64_t size = Ref<Resource>(memnew(Resource))->estimate_memory_usage();
+	ResourceCache::set_retention_budget(size * 2);
+
+	// The child is the least recently used one, but the parent keeps it alive until the parent is evicted.
+	Ref<Resource> child = memnew(Resource);
+	child->set_path("res://retained_child.tres");
+	ResourceCache::retain(child);
+	Ref<Resource> parent = memnew(Resource);
+	parent->set_path("res://retained_parent.tres");
+	parent->set_meta("child", child);
+	ResourceCache::retain(parent);
+	child.unref();
+	parent.unref();
+	CHECK_EQ(ResourceCache::get_retained_resource_count(), 2);
+
+	// Neither fits anymore, but the child can only go once the parent is released.
+	ResourceCache::set_retention_budget(size / 2);
+	CHECK_FALSE(ResourceCache::has("res://retained_parent.tres"));
+	CHECK_MESSAGE(
+			!ResourceCache::has("res://retained_child.tres"),
+			"Resources only kept alive by evicted ones should be evicted as well while over budget.");
+	CHECK_EQ(ResourceCache::get_retained_resource_count(), 0);
+	CHECK_EQ(ResourceCache::get_retained_memory(), 0u);
+
+	ResourceCache::set_retention_budget(0);
+}
+
+TEST_CASE("[Resource] Changing the path moves the cache entry") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_path("res://moved_a.tres");
+	CHECK(ResourceCache::get_ref("res://moved_a.tres") == resource);
+
+	resource->set_path("res://moved_b.tres");
+	CHECK_FALSE(ResourceCache::has("res://moved_a.tres"));
+	CHECK(ResourceCache::get_ref("res://moved_b.tres") == resource);
+
+	Ref<Resource> other = memnew(Resource);
+	ERR_PRINT_OFF;
+	other->set_path("res://moved_b.tres");
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(
+			ResourceCache::get_ref("res://moved_b.tres") == resource,
+			"A path already in use should not be taken without taking it over.");
+
+	other->set_path("res://moved_b.tres", true);
+	CHECK(ResourceCache::get_ref("res://moved_b.tres") == other);
+	CHECK(resource->get_path().is_empty());
+}
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
@@ -0,0 +1,178 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+class MessageRecorder : public Object {
+public:
+	LocalVector<int> producers;
+	LocalVector<int> indices;
+
+	void record(int p_producer, int p_index) {
+		producers.push_back(p_producer);
+		indices.push_back(p_index);
+	}
+};
+
+struct ProducerData {
+	CallQueue *queue = nullptr;
+	MessageRecorder *recorder = nullptr;
+	int producer = 0;
+	int count = 0;
+};
+
+static void push_messages(void *p_userdata) {
+	ProducerData *data = (ProducerData *)p_userdata;
+	for (int i = 0; i < data->count; i++) {
+		data->queue->push_callable(callable_mp(data->recorder, &MessageRecorder::record), data->producer, i);
+	}
+}
+
+TEST_CASE("[MessageQueue] Calls pushed from a thread are flushed in order") {
+	CallQueue queue;
+	MessageRecorder recorder;
+
+	ProducerData data;
+	data.queue = &queue;
+	data.recorder = &recorder;
+	data.count = 2000; // Enough to need several pages.
+
+	Thread thread;
+	thread.start(&push_messages, &data);
+	thread.wait_to_finish();
+
+	CHECK(queue.has_messages());
+	CHECK(queue.flush() == OK);
+	CHECK_FALSE(queue.has_messages());
+
+	REQUIRE(recorder.indices.size() == 2000);
+	for (int i = 0; i < 2000; i++) {
+		CHECK_MESSAGE(recorder.indices[i] == i, "Messages should be called in the order they were pushed.");
+	}
+}
+
+TEST_CASE("[MessageQueue] Calls pushed from several threads keep their order per thread") {
+	const int producer_count = 4;
+	const int message_count = 1000;
+
+	CallQueue queue;
+	MessageRecorder recorder;
+
+	ProducerData data[producer_count];
+	Thread threads[producer_count];
+	for (int i = 0; i < producer_count; i++) {
+		data[i].queue = &queue;
+		data[i].recorder = &recorder;
+		data[i].producer = i;
+		data[i].count = message_count;
+		threads[i].start(&push_messages, &data[i]);
+	}
+
+	// Flush while the producers are still pushing, then once more after they are done.
+	queue.flush();
+	for (int i = 0; i < producer_count; i++) {
+		threads[i].wait_to_finish();
+	}
+	queue.flush();
+	CHECK_FALSE(queue.has_messages());
+
+	REQUIRE(recorder.indices.size() == producer_count * message_count);
+	int next_index[producer_count] = {};
+	for (uint32_t i = 0; i < recorder.indices.size(); i++) {
+		int producer = recorder.producers[i];
+		CHECK(recorder.indices[i] == next_index[producer]);
+		next_index[producer]++;
+	}
+}
+
+TEST_CASE("[MessageQueue] Clearing discards calls pushed from threads") {
+	CallQueue queue;
+	MessageRecorder recorder;
+
+	ProducerData data;
+	data.queue = &queue;
+	data.recorder = &recorder;
+	data.count = 10;
+
+	Thread thread;
+	thread.start(&push_messages, &data);
+	thread.wait_to_finish();
+
+	queue.clear();
+	CHECK_FALSE(queue.has_messages());
+	queue.flush();
+	CHECK(recorder.indices.size() == 0);
+}
+
+TEST_CASE("[MessageQueue] Lanes of short-lived threads are reused") {
+	CallQueue queue;
+	MessageRecorder recorder;
+
+	for (int i = 0; i < 16; i++) {
+		ProducerData data;
+		data.queue = &queue;
+		data.recorder = &recorder;
+		data.producer = i;
+		data.count = 10;
+
+		Thread thread;
+		thread.start(&push_messages, &data);
+		thread.wait_to_finish();
+		queue.flush();
+	}
+
+	CHECK(recorder.indices.size() == 16 * 10);
+	CHECK_MESSAGE(queue.get_thread_lane_count() == 1, "Lanes should be handed back on flush, not kept for every thread ID.");
+
+	// A thread that keeps pushing across flushes gets a lane again after each of them.
+	ProducerData data;
+	data.queue = &queue;
+	data.recorder = &recorder;
+	data.count = 1000;
+	Thread thread;
+	thread.start(&push_messages, &data);
+	queue.flush();
+	thread.wait_to_finish();
+	queue.flush();
+	CHECK(recorder.indices.size() == 16 * 10 + 1000);
+	CHECK(queue.get_thread_lane_count() <= 2);
+}
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
@@ -290,6 +290,22 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+class SignalOrderObject : public Object {
+public:
+	Vector<int> *calls = nullptr;
+	int id = 0;
+	Object *emitter = nullptr;
+	Callable disconnect_on_call;
+
+	void on_signal() {
+		calls->push_back(id);
+		if (disconnect_on_call.is_valid()) {
+			emitter->disconnect("my_custom_signal", disconnect_on_call);
+			disconnect_on_call = Callable();
+		}
+	}
+};
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -430,6 +446,64 @@ TEST_CASE("[Object] Signals") {
 		object.get_all_signal_connections(&signal_connections);
 		CHECK(signal_connections.size() == 0);
 	}
+
+	SUBCASE("Emitting should call the connected methods in connection order") {
+		Vector<int> calls;
+		SignalOrderObject targets[8];
+		for (int i = 0; i < 8; i++) {
+			targets[i].calls = &calls;
+			targets[i].id = i;
+			object.connect("my_custom_signal", callable_mp(&targets[i], &SignalOrderObject::on_signal));
+		}
+
+		// Disconnect enough slots to compact the list, then connect one again.
+		for (int i = 0; i < 5; i++) {
+			object.disconnect("my_custom_signal", callable_mp(&targets[i], &SignalOrderObject::on_signal));
+		}
+		object.connect("my_custom_signal", callable_mp(&targets[2], &SignalOrderObject::on_signal));
+		object.emit_signal("my_custom_signal");
+
+		Vector<int> expected = { 5, 6, 7, 2 };
+		CHECK(calls == expected);
+	}
+
+	SUBCASE("Disconnecting during emission should only affect the following emissions") {
+		Vector<int> calls;
+		SignalOrderObject targets[3];
+		for (int i = 0; i < 3; i++) {
+			targets[i].calls = &calls;
+			targets[i].id = i;
+			targets[i].emitter = &object;
+			object.connect("my_custom_signal", callable_mp(&targets[i], &SignalOrderObject::on_signal));
+		}
+		targets[0].disconnect_on_call = callable_mp(&targets[1], &SignalOrderObject::on_signal);
+
+		object.emit_signal("my_custom_signal");
+		Vector<int> expected = { 0, 1, 2 };
+		CHECK(calls == expected);
+
+		calls.clear();
+		object.emit_signal("my_custom_signal");
+		expected = { 0, 2 };
+		CHECK(calls == expected);
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp(&targets[1], &SignalOrderObject::on_signal)));
+	}
+
+	SUBCASE("One-shot connections should only be called once") {
+		Vector<int> calls;
+		SignalOrderObject targets[2];
+		for (int i = 0; i < 2; i++) {
+			targets[i].calls = &calls;
+			targets[i].id = i;
+		}
+		object.connect("my_custom_signal", callable_mp(&targets[0], &SignalOrderObject::on_signal), Object::CONNECT_ONE_SHOT);
+		object.connect("my_custom_signal", callable_mp(&targets[1], &SignalOrderObject::on_signal));
+
+		object.emit_signal("my_custom_signal");
+		object.emit_signal("my_custom_signal");
+		Vector<int> expected = { 0, 1, 1 };
+		CHECK(calls == expected);
+	}
 }
 
 class NotificationObject1 : public Object {
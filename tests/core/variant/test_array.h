@@ -545,6 +545,45 @@ TEST_CASE("[Array] Recursive self comparison") {
 	a2.clear();
 }
 
+TEST_CASE("[Array] Typed element validation") {
+	Array int_array;
+	int_array.set_typed(Variant::INT, StringName(), Variant());
+	int_array.push_back(1);
+	int_array.push_front(0);
+	int_array.insert(2, 2);
+	int_array.set(1, 5);
+	CHECK_EQ(int_array, build_array(0, 5, 2));
+
+	Array float_array;
+	float_array.set_typed(Variant::FLOAT, StringName(), Variant());
+	float_array.push_back(1.5);
+	float_array.push_back(2); // Coerced to float.
+	float_array.set(0, 3); // Coerced to float.
+	CHECK_EQ(float_array[0].get_type(), Variant::FLOAT);
+	CHECK_EQ(float_array[1].get_type(), Variant::FLOAT);
+	CHECK_EQ(float_array, build_array(3.0, 2.0));
+
+	ERR_PRINT_OFF;
+	int_array.push_back("string");
+	int_array.set(0, "string");
+	CHECK_EQ(int_array.insert(0, 1.5), ERR_INVALID_PARAMETER);
+	ERR_PRINT_ON;
+	CHECK_EQ(int_array, build_array(0, 5, 2));
+
+	Array other_int_array;
+	other_int_array.set_typed(Variant::INT, StringName(), Variant());
+	other_int_array.push_back(7);
+	int_array.append_array(other_int_array);
+	CHECK_EQ(int_array, build_array(0, 5, 2, 7));
+
+	float_array.append_array(int_array); // Coerced to float.
+	CHECK_EQ(float_array.size(), 6);
+	CHECK_EQ(float_array[5].get_type(), Variant::FLOAT);
+
+	int_array.fill(4);
+	CHECK_EQ(int_array, build_array(4, 4, 4, 4));
+}
+
 TEST_CASE("[Array] Iteration") {
 	Array a1 = build_array(1, 2, 3);
 	Array a2 = build_array(1, 2, 3);
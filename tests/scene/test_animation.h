@@ -309,6 +309,120 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Baked transforms") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(1.0);
+	const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->position_track_insert_key(position_track, 0.0, Vector3(0, 0, 0));
+	animation->position_track_insert_key(position_track, 1.0, Vector3(4, 2, -2));
+	const int rotation_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+	animation->rotation_track_insert_key(rotation_track, 0.0, Quaternion());
+	animation->rotation_track_insert_key(rotation_track, 0.5, Quaternion(Vector3(0, 1, 0), Math_PI * 0.5));
+	// Same rotation as the identity, stored in the opposite hemisphere.
+	animation->rotation_track_insert_key(rotation_track, 1.0, Quaternion(0, 0, 0, -1));
+	const int value_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_insert_key(value_track, 0.0, 1.0);
+	const int scale_track = animation->add_track(Animation::TYPE_SCALE_3D);
+	animation->scale_track_insert_key(scale_track, 0.0, Vector3(1, 1, 1));
+	animation->scale_track_insert_key(scale_track, 1.0, Vector3(3, 1, 1));
+	const int empty_track = animation->add_track(Animation::TYPE_POSITION_3D);
+
+	CHECK_FALSE(animation->has_baked_transforms());
+	animation->bake_transforms(30);
+	REQUIRE(animation->has_baked_transforms());
+
+	CHECK(animation->baked_transforms_get_slot(position_track) == 0);
+	CHECK(animation->baked_transforms_get_slot(rotation_track) == 0);
+	CHECK(animation->baked_transforms_get_slot(scale_track) == 0);
+	CHECK(animation->baked_transforms_get_slot(value_track) == -1);
+	CHECK_MESSAGE(animation->baked_transforms_get_slot(empty_track) == -1, "Tracks without keys can't be baked.");
+
+	LocalVector<float> sample;
+	for (double time : { 0.0, 0.1, 0.25, 0.5, 0.6, 0.9, 1.0 }) {
+		animation->sample_baked_transforms(time, sample);
+
+		Vector3 position = animation->baked_transforms_get_position(sample, 0);
+		CHECK(position.is_equal_approx(animation->position_track_interpolate(position_track, time)));
+		Vector3 scale = animation->baked_transforms_get_scale(sample, 0);
+		CHECK(scale.is_equal_approx(animation->scale_track_interpolate(scale_track, time)));
+
+		Quaternion rotation = animation->baked_transforms_get_rotation(sample, 0);
+		Quaternion expected = animation->rotation_track_interpolate(rotation_track, time);
+		CHECK(rotation.is_normalized());
+		CHECK_MESSAGE(
+				Math::abs(rotation.dot(expected)) > 0.999,
+				"Baked rotations should match the track up to the baking rate, taking the shortest path.");
+	}
+
+	animation->sample_baked_transforms(2.0, sample);
+	CHECK_MESSAGE(
+			animation->baked_transforms_get_position(sample, 0).is_equal_approx(Vector3(4, 2, -2)),
+			"Sampling past the end should clamp to the last frame.");
+
+	animation->position_track_insert_key(position_track, 0.5, Vector3());
+	CHECK_MESSAGE(!animation->has_baked_transforms(), "Modifying the animation should clear baked transforms.");
+}
+
+TEST_CASE("[Animation] Baked transforms are cleared when keys change") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(1.0);
+	const int track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->position_track_insert_key(track, 0.0, Vector3(0, 0, 0));
+	animation->position_track_insert_key(track, 0.5, Vector3(1, 0, 0));
+	animation->position_track_insert_key(track, 1.0, Vector3(2, 0, 0));
+
+	animation->bake_transforms(30);
+	REQUIRE(animation->has_baked_transforms());
+	animation->track_set_key_time(track, 1, 0.25);
+	CHECK_MESSAGE(!animation->has_baked_transforms(), "Moving a key should clear baked transforms.");
+
+	animation->bake_transforms(30);
+	REQUIRE(animation->has_baked_transforms());
+	animation->optimize();
+	CHECK_MESSAGE(!animation->has_baked_transforms(), "Optimizing should clear baked transforms.");
+
+	animation->bake_transforms(30);
+	REQUIRE(animation->has_baked_transforms());
+	animation->set("tracks/0/keys", PackedFloat32Array{ 0.0, 1.0, 5.0, 0.0, 0.0 });
+	CHECK_MESSAGE(!animation->has_baked_transforms(), "Setting track data as a property should clear baked transforms.");
+	CHECK(animation->position_track_interpolate(track, 0.5).is_equal_approx(Vector3(5, 0, 0)));
+}
+
+TEST_CASE("[Animation] Only linearly interpolated tracks are baked") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(1.0);
+	const int linear_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->position_track_insert_key(linear_track, 0.0, Vector3(0, 0, 0));
+	animation->position_track_insert_key(linear_track, 1.0, Vector3(1, 0, 0));
+	const int nearest_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_interpolation_type(nearest_track, Animation::INTERPOLATION_NEAREST);
+	animation->position_track_insert_key(nearest_track, 0.0, Vector3(0, 0, 0));
+	animation->position_track_insert_key(nearest_track, 1.0, Vector3(1, 0, 0));
+	const int cubic_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+	animation->track_set_interpolation_type(cubic_track, Animation::INTERPOLATION_CUBIC);
+	animation->rotation_track_insert_key(cubic_track, 0.0, Quaternion());
+	animation->rotation_track_insert_key(cubic_track, 1.0, Quaternion(Vector3(0, 1, 0), Math_PI * 0.5));
+	const int linear_angle_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+	animation->track_set_interpolation_type(linear_angle_track, Animation::INTERPOLATION_LINEAR_ANGLE);
+	animation->rotation_track_insert_key(linear_angle_track, 0.0, Quaternion());
+	animation->rotation_track_insert_key(linear_angle_track, 1.0, Quaternion(Vector3(0, 1, 0), Math_PI * 0.5));
+
+	animation->bake_transforms(30);
+	REQUIRE(animation->has_baked_transforms());
+	CHECK(animation->baked_transforms_get_slot(linear_track) == 0);
+	CHECK(animation->baked_transforms_get_slot(linear_angle_track) == 0);
+	CHECK_MESSAGE(animation->baked_transforms_get_slot(nearest_track) == -1, "Tracks using nearest interpolation can't be baked.");
+	CHECK_MESSAGE(animation->baked_transforms_get_slot(cubic_track) == -1, "Tracks using cubic interpolation can't be baked.");
+
+	LocalVector<float> sample;
+	animation->sample_baked_transforms(0.4, sample);
+	CHECK(animation->baked_transforms_get_position(sample, 0).is_equal_approx(Vector3(0.4, 0, 0)));
+	CHECK(animation->position_track_interpolate(nearest_track, 0.4).is_equal_approx(Vector3(0, 0, 0)));
+
+	animation->track_set_interpolation_type(nearest_track, Animation::INTERPOLATION_LINEAR);
+	CHECK_MESSAGE(!animation->has_baked_transforms(), "Changing the interpolation should clear baked transforms.");
+}
+
 } // namespace TestAnimation
 
 #endif // TEST_ANIMATION_H
@@ -0,0 +1,219 @@
+/**************************************************************************/
+/*  test_animation_mixer.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ANIMATION_MIXER_H
+#define TEST_ANIMATION_MIXER_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/3d/camera_3d.h"
+#include "scene/animation/animation_player.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAnimationMixer {
+
+TEST_CASE("[SceneTree][AnimationMixer] Batch evaluation matches serial evaluation") {
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	animation->set_loop_mode(Animation::LOOP_LINEAR);
+
+	const int position_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(position_track, NodePath(".:position"));
+	animation->track_insert_key(position_track, 0.0, Vector2(0, 0));
+	animation->track_insert_key(position_track, 0.5, Vector2(10, -4));
+	animation->track_insert_key(position_track, 1.0, Vector2(0, 0));
+
+	const int rotation_track = animation->add_track(Animation::TYPE_BEZIER);
+	animation->track_set_path(rotation_track, NodePath(".:rotation"));
+	animation->bezier_track_insert_key(rotation_track, 0.0, 0.0, Vector2(), Vector2(0.25, 0.5));
+	animation->bezier_track_insert_key(rotation_track, 1.0, 2.0, Vector2(-0.25, 0.0), Vector2());
+
+	// Discrete keys are applied on the main thread during the commit phase.
+	const int visible_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(visible_track, NodePath(".:visible"));
+	animation->value_track_set_update_mode(visible_track, Animation::UPDATE_DISCRETE);
+	animation->track_insert_key(visible_track, 0.0, true);
+	animation->track_insert_key(visible_track, 0.3, false);
+	animation->track_insert_key(visible_track, 0.7, true);
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("walk", animation);
+
+	const int count = 8;
+	Vector<Node2D *> serial_targets;
+	Vector<Node2D *> batch_targets;
+	for (int i = 0; i < count * 2; i++) {
+		bool batch = i >= count;
+		Node2D *target = memnew(Node2D);
+		AnimationPlayer *player = memnew(AnimationPlayer);
+		target->add_child(player);
+		SceneTree::get_singleton()->get_root()->add_child(target);
+
+		player->add_animation_library("", library);
+		player->set_batch_evaluation_enabled(batch);
+		player->set_speed_scale(1.0 + (i % count) * 0.25);
+		player->play("walk");
+
+		if (batch) {
+			batch_targets.push_back(target);
+		} else {
+			serial_targets.push_back(target);
+		}
+	}
+
+	for (int frame = 0; frame < 30; frame++) {
+		SceneTree::get_singleton()->process(0.05);
+		for (int i = 0; i < count; i++) {
+			CHECK_MESSAGE(batch_targets[i]->get_position() == serial_targets[i]->get_position(), vformat("Position of mixer %d differs at frame %d.", i, frame));
+			CHECK_MESSAGE(batch_targets[i]->get_rotation() == serial_targets[i]->get_rotation(), vformat("Rotation of mixer %d differs at frame %d.", i, frame));
+			CHECK_MESSAGE(batch_targets[i]->is_visible() == serial_targets[i]->is_visible(), vformat("Visibility of mixer %d differs at frame %d.", i, frame));
+		}
+	}
+	// The results are committed within the frame they were evaluated in.
+	CHECK(batch_targets[0]->get_position() != Vector2());
+
+	for (int i = 0; i < count; i++) {
+		memdelete(serial_targets[i]);
+		memdelete(batch_targets[i]);
+	}
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Manual advance commits a pending batch result first") {
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	const int track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(track, NodePath(".:position:x"));
+	animation->track_insert_key(track, 0.0, 0.0);
+	animation->track_insert_key(track, 1.0, 100.0);
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("move", animation);
+
+	Node2D *target = memnew(Node2D);
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	target->add_child(player);
+	SceneTree::get_singleton()->get_root()->add_child(target);
+	player->add_animation_library("", library);
+	player->set_batch_evaluation_enabled(true);
+	player->play("move");
+	SceneTree::get_singleton()->process(0.0);
+
+	// Queue a result without flushing, then advance manually.
+	player->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+	player->advance(0.25);
+	CHECK(target->get_position().x == doctest::Approx(25.0));
+
+	// The deferred flush must not apply anything twice.
+	SceneTree::get_singleton()->process(0.0);
+	CHECK(target->get_position().x == doctest::Approx(25.0));
+
+	memdelete(target);
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Update LOD") {
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(10.0);
+	const int track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track, NodePath("Body"));
+	animation->position_track_insert_key(track, 0.0, Vector3(0, 0, 0));
+	animation->position_track_insert_key(track, 10.0, Vector3(10, 0, 0));
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("move", animation);
+
+	Camera3D *camera = memnew(Camera3D);
+	SceneTree::get_singleton()->get_root()->add_child(camera);
+	camera->make_current();
+
+	// The reference is processed every frame, the other one every 8 frames as it is beyond 100 units.
+	Node3D *bodies[2];
+	AnimationPlayer *players[2];
+	for (int i = 0; i < 2; i++) {
+		Node3D *target = memnew(Node3D);
+		bodies[i] = memnew(Node3D);
+		bodies[i]->set_name("Body");
+		target->add_child(bodies[i]);
+		players[i] = memnew(AnimationPlayer);
+		target->add_child(players[i]);
+		SceneTree::get_singleton()->get_root()->add_child(target);
+		target->set_position(Vector3(i, 0, -200));
+		players[i]->add_animation_library("", library);
+		players[i]->set_lod_enabled(i == 1);
+		players[i]->play("move");
+	}
+	Node3D *reference = bodies[0];
+	Node3D *body = bodies[1];
+
+	SUBCASE("Without interpolation") {
+		players[1]->set_lod_interpolation_enabled(false);
+		int updates = 0;
+		Vector3 last_position = body->get_position();
+		for (int frame = 0; frame < 40; frame++) {
+			SceneTree::get_singleton()->process(0.05);
+			if (body->get_position() != last_position) {
+				// Skipped frames are caught up with, so an update matches the reference.
+				CHECK(body->get_position().is_equal_approx(reference->get_position()));
+				last_position = body->get_position();
+				updates++;
+			}
+		}
+		CHECK(updates >= 4);
+		CHECK(updates <= 6);
+	}
+
+	SUBCASE("With interpolation") {
+		for (int frame = 0; frame < 20; frame++) {
+			SceneTree::get_singleton()->process(0.05);
+		}
+		Vector3 last_position = body->get_position();
+		for (int frame = 0; frame < 20; frame++) {
+			SceneTree::get_singleton()->process(0.05);
+			// Interpolated poses move every frame, one update interval behind the reference.
+			CHECK(body->get_position().x > last_position.x);
+			CHECK(body->get_position().x < reference->get_position().x);
+			last_position = body->get_position();
+		}
+	}
+
+	memdelete(players[0]->get_parent());
+	memdelete(players[1]->get_parent());
+	memdelete(camera);
+}
+
+} // namespace TestAnimationMixer
+
+#endif // TEST_ANIMATION_MIXER_H
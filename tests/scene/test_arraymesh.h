@@ -172,6 +172,13 @@ TEST_CASE("[SceneTree][ArrayMesh] Surface metadata tests.") {
 		REQUIRE(mesh->get_surface_count() == 2);
 	}
 
+	SUBCASE("Memory usage estimate accounts for the surface arrays.") {
+		const int vertex_count = mesh->surface_get_array_len(0) + mesh->surface_get_array_len(1);
+		const int index_count = mesh->surface_get_array_index_len(0) + mesh->surface_get_array_index_len(1);
+		Ref<ArrayMesh> empty_mesh = memnew(ArrayMesh);
+		CHECK(mesh->estimate_memory_usage() >= empty_mesh->estimate_memory_usage() + vertex_count * sizeof(float) * 3 + index_count * 2);
+	}
+
 	SUBCASE("Get the surface array from mesh.") {
 		REQUIRE(mesh->surface_get_arrays(0)[0] == cylinder_array[0]);
 		REQUIRE(mesh->surface_get_arrays(1)[0] == box_array[0]);
@@ -0,0 +1,152 @@
+/**************************************************************************/
+/*  test_compressed_texture.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_COMPRESSED_TEXTURE_H
+#define TEST_COMPRESSED_TEXTURE_H
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "scene/resources/compressed_texture.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCompressedTexture {
+
+static Ref<Image> make_mipmapped_image() {
+	Ref<Image> image = Image::create_empty(64, 64, true, Image::FORMAT_RGBA8);
+	image->fill(Color(1, 0, 0));
+	for (int i = 1; i <= image->get_mipmap_count(); i++) {
+		// Give each mipmap a distinct color to tell them apart once loaded.
+		int offset, size;
+		image->get_mipmap_offset_and_size(i, offset, size);
+		uint8_t *w = image->ptrw() + offset;
+		for (int j = 0; j < size; j += 4) {
+			w[j + 0] = 0;
+			w[j + 1] = uint8_t(i * 10);
+			w[j + 2] = 0;
+			w[j + 3] = 255;
+		}
+	}
+	return image;
+}
+
+static void store_header(const Ref<FileAccess> &p_file, const Ref<Image> &p_image, CompressedTexture2D::DataFormat p_data_format) {
+	p_file->store_buffer((const uint8_t *)"GST2", 4);
+	p_file->store_32(CompressedTexture2D::FORMAT_VERSION);
+	p_file->store_32(p_image->get_width());
+	p_file->store_32(p_image->get_height());
+	p_file->store_32(CompressedTexture2D::FORMAT_BIT_STREAM | CompressedTexture2D::FORMAT_BIT_HAS_MIPMAPS);
+	p_file->store_32(0); // Mipmap limit.
+	p_file->store_32(0);
+	p_file->store_32(0);
+	p_file->store_32(0);
+	p_file->store_32(p_data_format);
+	p_file->store_16(p_image->get_width());
+	p_file->store_16(p_image->get_height());
+	p_file->store_32(p_image->get_mipmap_count());
+	p_file->store_32(p_image->get_format());
+}
+
+static Ref<Image> load_image(const String &p_path, int p_size_limit) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_V(f.is_null(), Ref<Image>());
+	// Skip the header written by store_header(), up to the data format.
+	f->seek(4 + 8 * sizeof(uint32_t));
+	return CompressedTexture2D::load_image_from_file(f, p_size_limit);
+}
+
+TEST_CASE("[CompressedTexture2D] Loading mipmaps within a size limit") {
+	Ref<Image> image = make_mipmapped_image();
+
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("compressed_texture.ctex");
+	{
+		Ref<FileAccess> f = FileAccess::open(save_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		store_header(f, image, CompressedTexture2D::DATA_FORMAT_IMAGE);
+		f->store_buffer(image->get_data().ptr(), image->get_data().size());
+	}
+
+	Ref<Image> full = load_image(save_path, 0);
+	REQUIRE(full.is_valid());
+	CHECK(full->get_width() == 64);
+	CHECK(full->get_data() == image->get_data());
+
+	Ref<Image> limited = load_image(save_path, 16);
+	REQUIRE(limited.is_valid());
+	CHECK(limited->get_width() == 16);
+	CHECK(limited->get_height() == 16);
+	CHECK(limited->has_mipmaps());
+	CHECK_MESSAGE(
+			limited->get_pixel(0, 0).is_equal_approx(Color(0, 20 / 255.0, 0)),
+			"The largest loaded mipmap should be the one matching the size limit.");
+	CHECK(limited->get_mipmap_count() == image->get_mipmap_count() - 2);
+}
+
+TEST_CASE("[CompressedTexture2D] Loading lossless mipmaps within a size limit") {
+	REQUIRE(Image::png_packer != nullptr);
+	Ref<Image> image = make_mipmapped_image();
+
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("compressed_texture_lossless.ctex");
+	{
+		Ref<FileAccess> f = FileAccess::open(save_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		store_header(f, image, CompressedTexture2D::DATA_FORMAT_PNG);
+		// Lossless textures store each mipmap as its own PNG.
+		for (int i = 0; i <= image->get_mipmap_count(); i++) {
+			int offset, size, width, height;
+			image->get_mipmap_offset_size_and_dimensions(i, offset, size, width, height);
+			Ref<Image> mipmap = Image::create_from_data(width, height, false, image->get_format(), image->get_data().slice(offset, offset + size));
+			Vector<uint8_t> png = Image::png_packer(mipmap);
+			f->store_32(png.size());
+			f->store_buffer(png.ptr(), png.size());
+		}
+	}
+
+	Ref<Image> full = load_image(save_path, 0);
+	REQUIRE(full.is_valid());
+	CHECK(full->get_width() == 64);
+	CHECK(full->get_data() == image->get_data());
+
+	Ref<Image> limited = load_image(save_path, 16);
+	REQUIRE(limited.is_valid());
+	CHECK(limited->get_width() == 16);
+	CHECK(limited->get_height() == 16);
+	CHECK(limited->has_mipmaps());
+	CHECK(limited->get_mipmap_count() == image->get_mipmap_count() - 2);
+	CHECK(limited->get_pixel(0, 0).is_equal_approx(Color(0, 20 / 255.0, 0)));
+	int offset = image->get_mipmap_offset(2);
+	CHECK_MESSAGE(
+			limited->get_data() == image->get_data().slice(offset),
+			"The mipmaps below the size limit should be loaded as they were stored.");
+}
+
+} // namespace TestCompressedTexture
+
+#endif // TEST_COMPRESSED_TEXTURE_H
@@ -0,0 +1,242 @@
+/**************************************************************************/
+/*  test_hlod_instance_3d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_HLOD_INSTANCE_3D_H
+#define TEST_HLOD_INSTANCE_3D_H
+
+#include "scene/3d/hlod_instance_3d.h"
+#include "scene/3d/mesh_instance_3d.h"
+#include "scene/main/window.h"
+#include "scene/resources/3d/primitive_meshes.h"
+
+#include "tests/test_macros.h"
+
+namespace TestHLODInstance3D {
+
+static MeshInstance3D *add_box(Node3D *p_scene, const Ref<Mesh> &p_mesh, const Vector3 &p_position) {
+	MeshInstance3D *mi = memnew(MeshInstance3D);
+	mi->set_mesh(p_mesh);
+	mi->set_position(p_position);
+	p_scene->add_child(mi);
+	mi->set_owner(p_scene);
+	return mi;
+}
+
+TEST_CASE("[SceneTree][HLODInstance3D] Bake merges clustered instances into proxies") {
+	Node3D *scene = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(scene);
+
+	Ref<BoxMesh> box;
+	box.instantiate();
+	const int box_index_count = box->surface_get_array_index_len(0);
+
+	MeshInstance3D *near_a = add_box(scene, box, Vector3(1, 0, 1));
+	MeshInstance3D *near_b = add_box(scene, box, Vector3(5, 0, 1));
+	MeshInstance3D *near_c = add_box(scene, box, Vector3(9, 0, 9));
+	MeshInstance3D *lone = add_box(scene, box, Vector3(100, 0, 1));
+
+	HLODInstance3D *hlod = memnew(HLODInstance3D);
+	hlod->set_bake_cell_size(16.0);
+	hlod->set_bake_simplification_distance(0.0);
+	hlod->set_proxy_distance(50.0);
+	scene->add_child(hlod);
+	hlod->set_owner(scene);
+
+	CHECK(hlod->bake(scene) == HLODInstance3D::BAKE_ERROR_OK);
+
+	// The lone instance doesn't reach the minimum instance count of its cell.
+	REQUIRE(hlod->get_child_count() == 1);
+	MeshInstance3D *proxy = Object::cast_to<MeshInstance3D>(hlod->get_child(0));
+	REQUIRE(proxy != nullptr);
+	CHECK(proxy->get_owner() == scene);
+	CHECK(proxy->get_visibility_range_begin() == doctest::Approx(50.0));
+
+	Ref<Mesh> proxy_mesh = proxy->get_mesh();
+	REQUIRE(proxy_mesh.is_valid());
+	CHECK_MESSAGE(proxy_mesh->get_surface_count() == 1, "Surfaces sharing a material should be merged together.");
+	CHECK(proxy_mesh->surface_get_array_index_len(0) == box_index_count * 3);
+	CHECK(proxy_mesh->get_aabb().has_point(Vector3(9, 0, 9)));
+
+	CHECK(near_a->get_node_or_null(near_a->get_visibility_parent()) == proxy);
+	CHECK(near_b->get_node_or_null(near_b->get_visibility_parent()) == proxy);
+	CHECK(near_c->get_node_or_null(near_c->get_visibility_parent()) == proxy);
+	CHECK(lone->get_visibility_parent().is_empty());
+
+	SUBCASE("Proxy distance updates existing proxies") {
+		hlod->set_proxy_distance(75.0);
+		CHECK(proxy->get_visibility_range_begin() == doctest::Approx(75.0));
+	}
+
+	SUBCASE("Baking again replaces the proxies") {
+		CHECK(hlod->bake(scene) == HLODInstance3D::BAKE_ERROR_OK);
+		REQUIRE(hlod->get_child_count() == 1);
+		CHECK(hlod->get_child(0) != proxy);
+		CHECK(near_a->get_node_or_null(near_a->get_visibility_parent()) == hlod->get_child(0));
+	}
+
+	SUBCASE("Clearing the proxies detaches the merged instances") {
+		hlod->clear_proxies();
+		CHECK(hlod->get_child_count() == 0);
+		CHECK(near_a->get_visibility_parent().is_empty());
+		CHECK(near_c->get_visibility_parent().is_empty());
+	}
+
+	SUBCASE("Nothing to merge") {
+		hlod->set_bake_min_instances(4);
+		CHECK(hlod->bake(scene) == HLODInstance3D::BAKE_ERROR_NO_MESHES);
+		CHECK(hlod->get_child_count() == 0);
+		CHECK(near_b->get_visibility_parent().is_empty());
+	}
+
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][HLODInstance3D] Bake skips instances outside of the bake mask") {
+	Node3D *scene = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(scene);
+
+	Ref<BoxMesh> box;
+	box.instantiate();
+
+	add_box(scene, box, Vector3(1, 0, 1));
+	MeshInstance3D *excluded = add_box(scene, box, Vector3(2, 0, 1));
+	excluded->set_layer_mask(2);
+
+	HLODInstance3D *hlod = memnew(HLODInstance3D);
+	hlod->set_bake_mask(1);
+	scene->add_child(hlod);
+	hlod->set_owner(scene);
+
+	CHECK(hlod->bake(scene) == HLODInstance3D::BAKE_ERROR_NO_MESHES);
+	CHECK(excluded->get_visibility_parent().is_empty());
+
+	hlod->set_bake_mask(3);
+	CHECK(hlod->bake(scene) == HLODInstance3D::BAKE_ERROR_OK);
+	CHECK_FALSE(excluded->get_visibility_parent().is_empty());
+
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][HLODInstance3D] Bake skips instances with surfaces that can't be merged") {
+	Node3D *scene = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(scene);
+
+	Ref<BoxMesh> box;
+	box.instantiate();
+
+	MeshInstance3D *mergeable_a = add_box(scene, box, Vector3(1, 0, 1));
+	MeshInstance3D *mergeable_b = add_box(scene, box, Vector3(2, 0, 1));
+
+	// A triangle surface along with a line surface, which can't be merged.
+	Ref<ArrayMesh> mixed_mesh;
+	mixed_mesh.instantiate();
+	mixed_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, box->surface_get_arrays(0));
+	Array lines;
+	lines.resize(Mesh::ARRAY_MAX);
+	lines[Mesh::ARRAY_VERTEX] = PackedVector3Array{ Vector3(0, 0, 0), Vector3(0, 1, 0) };
+	mixed_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_LINES, lines);
+	MeshInstance3D *mixed = add_box(scene, mixed_mesh, Vector3(3, 0, 1));
+
+	Ref<ORMMaterial3D> transparent_material;
+	transparent_material.instantiate();
+	transparent_material->set_transparency(BaseMaterial3D::TRANSPARENCY_ALPHA);
+	MeshInstance3D *transparent = add_box(scene, box, Vector3(4, 0, 1));
+	transparent->set_surface_override_material(0, transparent_material);
+
+	Ref<StandardMaterial3D> overlay_material;
+	overlay_material.instantiate();
+	MeshInstance3D *overlaid = add_box(scene, box, Vector3(5, 0, 1));
+	overlaid->set_material_overlay(overlay_material);
+
+	HLODInstance3D *hlod = memnew(HLODInstance3D);
+	hlod->set_bake_cell_size(16.0);
+	hlod->set_bake_simplification_distance(0.0);
+	scene->add_child(hlod);
+	hlod->set_owner(scene);
+
+	CHECK(hlod->bake(scene) == HLODInstance3D::BAKE_ERROR_OK);
+	REQUIRE(hlod->get_child_count() == 1);
+	MeshInstance3D *proxy = Object::cast_to<MeshInstance3D>(hlod->get_child(0));
+	REQUIRE(proxy != nullptr);
+
+	Ref<Mesh> proxy_mesh = proxy->get_mesh();
+	REQUIRE(proxy_mesh.is_valid());
+	CHECK(proxy_mesh->get_surface_count() == 1);
+	CHECK(proxy_mesh->surface_get_array_index_len(0) == box->surface_get_array_index_len(0) * 2);
+
+	CHECK(mergeable_a->get_node_or_null(mergeable_a->get_visibility_parent()) == proxy);
+	CHECK(mergeable_b->get_node_or_null(mergeable_b->get_visibility_parent()) == proxy);
+	CHECK_MESSAGE(mixed->get_visibility_parent().is_empty(), "Instances with surfaces missing from the proxy must stay visible.");
+	CHECK_MESSAGE(transparent->get_visibility_parent().is_empty(), "Instances with transparent surfaces must stay visible.");
+	CHECK_MESSAGE(overlaid->get_visibility_parent().is_empty(), "Instances with a material overlay must stay visible.");
+
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][HLODInstance3D] Proxies cast shadows like the instances they merge") {
+	Node3D *scene = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(scene);
+
+	Ref<BoxMesh> box;
+	box.instantiate();
+
+	MeshInstance3D *casting_a = add_box(scene, box, Vector3(1, 0, 1));
+	MeshInstance3D *casting_b = add_box(scene, box, Vector3(2, 0, 1));
+	MeshInstance3D *not_casting_a = add_box(scene, box, Vector3(3, 0, 1));
+	MeshInstance3D *not_casting_b = add_box(scene, box, Vector3(4, 0, 1));
+	not_casting_a->set_cast_shadows_setting(GeometryInstance3D::SHADOW_CASTING_SETTING_OFF);
+	not_casting_b->set_cast_shadows_setting(GeometryInstance3D::SHADOW_CASTING_SETTING_OFF);
+
+	HLODInstance3D *hlod = memnew(HLODInstance3D);
+	hlod->set_bake_cell_size(16.0);
+	hlod->set_bake_simplification_distance(0.0);
+	scene->add_child(hlod);
+	hlod->set_owner(scene);
+
+	CHECK(hlod->bake(scene) == HLODInstance3D::BAKE_ERROR_OK);
+	REQUIRE_MESSAGE(hlod->get_child_count() == 2, "Instances casting shadows differently should not share a proxy.");
+
+	MeshInstance3D *casting_proxy = Object::cast_to<MeshInstance3D>(casting_a->get_node_or_null(casting_a->get_visibility_parent()));
+	MeshInstance3D *not_casting_proxy = Object::cast_to<MeshInstance3D>(not_casting_a->get_node_or_null(not_casting_a->get_visibility_parent()));
+	REQUIRE(casting_proxy != nullptr);
+	REQUIRE(not_casting_proxy != nullptr);
+	CHECK(casting_proxy != not_casting_proxy);
+	CHECK(casting_b->get_node_or_null(casting_b->get_visibility_parent()) == casting_proxy);
+	CHECK(not_casting_b->get_node_or_null(not_casting_b->get_visibility_parent()) == not_casting_proxy);
+
+	CHECK(casting_proxy->get_cast_shadows_setting() == GeometryInstance3D::SHADOW_CASTING_SETTING_ON);
+	CHECK(not_casting_proxy->get_cast_shadows_setting() == GeometryInstance3D::SHADOW_CASTING_SETTING_OFF);
+
+	memdelete(scene);
+}
+
+} // namespace TestHLODInstance3D
+
+#endif // TEST_HLOD_INSTANCE_3D_H
@@ -0,0 +1,179 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "scene/3d/mesh_instance_3d.h"
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+#include "servers/rendering/renderer_scene_cull.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TransformNotifiedNode3D : public Node3D {
+	GDCLASS(TransformNotifiedNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			notified++;
+		}
+	}
+
+public:
+	int notified = 0;
+};
+
+TEST_CASE("[SceneTree][Node3D] Transform change propagation") {
+	TransformNotifiedNode3D *parent = memnew(TransformNotifiedNode3D);
+	TransformNotifiedNode3D *child = memnew(TransformNotifiedNode3D);
+	TransformNotifiedNode3D *grandchild = memnew(TransformNotifiedNode3D);
+	parent->add_child(child);
+	child->add_child(grandchild);
+	parent->set_notify_transform(true);
+	child->set_notify_transform(true);
+	grandchild->set_notify_transform(true);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	parent->notified = 0;
+	child->notified = 0;
+	grandchild->notified = 0;
+
+	SUBCASE("Repeated moves within a frame notify every node once") {
+		parent->set_position(Vector3(1, 0, 0));
+		child->set_position(Vector3(0, 1, 0));
+		parent->set_position(Vector3(2, 0, 0));
+		grandchild->set_position(Vector3(0, 0, 1));
+		parent->set_position(Vector3(3, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		CHECK_EQ(parent->notified, 1);
+		CHECK_EQ(child->notified, 1);
+		CHECK_EQ(grandchild->notified, 1);
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(3, 1, 1)));
+
+		parent->set_position(Vector3(4, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(grandchild->notified, 2);
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(4, 1, 1)));
+	}
+
+	SUBCASE("Reading the global transform between moves keeps it up to date") {
+		parent->set_position(Vector3(1, 0, 0));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(1, 0, 0)));
+		parent->set_position(Vector3(2, 0, 0));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(2, 0, 0)));
+		child->set_position(Vector3(0, 1, 0));
+		parent->set_position(Vector3(3, 0, 0));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(3, 1, 0)));
+	}
+
+	SUBCASE("Nodes stay notified after a forced update or enabling notifications mid-frame") {
+		grandchild->set_notify_transform(false);
+		parent->set_position(Vector3(1, 0, 0));
+		child->force_update_transform();
+		CHECK_EQ(child->notified, 1);
+		grandchild->set_notify_transform(true);
+		parent->set_position(Vector3(2, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		CHECK_EQ(parent->notified, 1);
+		CHECK_EQ(child->notified, 2);
+		CHECK_EQ(grandchild->notified, 1);
+	}
+
+	SUBCASE("Children added after a move are notified when moving again") {
+		parent->set_position(Vector3(1, 0, 0));
+		TransformNotifiedNode3D *added = memnew(TransformNotifiedNode3D);
+		added->set_notify_transform(true);
+		child->add_child(added);
+		parent->set_position(Vector3(2, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		CHECK_EQ(added->notified, 1);
+		CHECK(added->get_global_position().is_equal_approx(Vector3(2, 0, 0)));
+
+		parent->set_position(Vector3(3, 0, 0));
+		TransformNotifiedNode3D *added_later = memnew(TransformNotifiedNode3D);
+		child->add_child(added_later);
+		CHECK(added_later->get_global_position().is_equal_approx(Vector3(3, 0, 0)));
+		added_later->set_notify_transform(true);
+		parent->set_position(Vector3(4, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		CHECK_EQ(added->notified, 2);
+		CHECK_EQ(added_later->notified, 1);
+		CHECK(added_later->get_global_position().is_equal_approx(Vector3(4, 0, 0)));
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node3D] Visual instance transforms are submitted when flushing") {
+	RendererSceneCull *scene_cull = RendererSceneCull::singleton;
+	REQUIRE(scene_cull != nullptr);
+
+	Node3D *parent = memnew(Node3D);
+	MeshInstance3D *first = memnew(MeshInstance3D);
+	MeshInstance3D *second = memnew(MeshInstance3D);
+	parent->add_child(first);
+	first->add_child(second);
+	first->set_position(Vector3(0, 1, 0));
+	second->set_position(Vector3(0, 0, 1));
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+	SceneTree::get_singleton()->flush_transform_notifications();
+
+	CHECK(scene_cull->instance_owner.get_or_null(first->get_instance())->transform.is_equal_approx(first->get_global_transform()));
+	CHECK(scene_cull->instance_owner.get_or_null(second->get_instance())->transform.is_equal_approx(second->get_global_transform()));
+
+	parent->set_position(Vector3(1, 0, 0));
+	second->rotate_y(Math_PI / 2);
+	parent->set_position(Vector3(2, 0, 0));
+	SceneTree::get_singleton()->flush_transform_notifications();
+
+	CHECK(scene_cull->instance_owner.get_or_null(first->get_instance())->transform.origin.is_equal_approx(Vector3(2, 1, 0)));
+	CHECK(scene_cull->instance_owner.get_or_null(second->get_instance())->transform.is_equal_approx(second->get_global_transform()));
+
+	// Leaving the tree mid-frame must not leave a freed instance behind.
+	parent->set_position(Vector3(3, 0, 0));
+	first->remove_child(second);
+	memdelete(second);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK(scene_cull->instance_owner.get_or_null(first->get_instance())->transform.origin.is_equal_approx(Vector3(3, 1, 0)));
+
+	memdelete(parent);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
@@ -31,10 +31,59 @@
 #ifndef TEST_PACKED_SCENE_H
 #define TEST_PACKED_SCENE_H
 
+#include "scene/2d/node_2d.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
 
+class _TestPackedSceneNode : public Node {
+	GDCLASS(_TestPackedSceneNode, Node);
+
+	Vector2 value;
+	real_t indexed_values[2] = {};
+	int dynamic_value = 0;
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_value", "value"), &_TestPackedSceneNode::set_value);
+		ClassDB::bind_method(D_METHOD("get_value"), &_TestPackedSceneNode::get_value);
+		ClassDB::bind_method(D_METHOD("set_indexed_value", "index", "value"), &_TestPackedSceneNode::set_indexed_value);
+		ClassDB::bind_method(D_METHOD("get_indexed_value", "index"), &_TestPackedSceneNode::get_indexed_value);
+
+		ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "value"), "set_value", "get_value");
+		ADD_PROPERTYI(PropertyInfo(Variant::FLOAT, "indexed_value_0"), "set_indexed_value", "get_indexed_value", 0);
+		ADD_PROPERTYI(PropertyInfo(Variant::FLOAT, "indexed_value_1"), "set_indexed_value", "get_indexed_value", 1);
+	}
+
+	// A property without a bound setter, which must still go through Object::set().
+	bool _set(const StringName &p_name, const Variant &p_value) {
+		if (p_name == "dynamic_value") {
+			dynamic_value = p_value;
+			return true;
+		}
+		return false;
+	}
+
+	bool _get(const StringName &p_name, Variant &r_ret) const {
+		if (p_name == "dynamic_value") {
+			r_ret = dynamic_value;
+			return true;
+		}
+		return false;
+	}
+
+	void _get_property_list(List<PropertyInfo> *p_list) const {
+		p_list->push_back(PropertyInfo(Variant::INT, "dynamic_value"));
+	}
+
+public:
+	void set_value(const Vector2 &p_value) { value = p_value; }
+	Vector2 get_value() const { return value; }
+	void set_indexed_value(int p_index, real_t p_value) { indexed_values[p_index] = p_value; }
+	real_t get_indexed_value(int p_index) const { return indexed_values[p_index]; }
+	int get_dynamic_value() const { return dynamic_value; }
+};
+
 namespace TestPackedScene {
 
 TEST_CASE("[PackedScene] Pack Scene and Retrieve State") {
@@ -75,6 +124,30 @@ TEST_CASE("[PackedScene] Clear Packed Scene") {
 	memdelete(scene);
 }
 
+TEST_CASE("[PackedScene] Memory Usage Estimate") {
+	// Create a scene with a child to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	Node *child = memnew(Node);
+	child->set_name("TestChild");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> empty_scene = memnew(PackedScene);
+	Ref<PackedScene> packed_scene = memnew(PackedScene);
+	packed_scene->pack(scene);
+	const uint64_t size = packed_scene->estimate_memory_usage();
+	CHECK(size > empty_scene->estimate_memory_usage());
+
+	// Built-in resources are only kept alive by the scene, so they weigh with it.
+	Ref<Resource> built_in = memnew(Resource);
+	child->set_meta("built_in", built_in);
+	packed_scene->pack(scene);
+	CHECK(packed_scene->estimate_memory_usage() >= size + built_in->estimate_memory_usage());
+
+	memdelete(scene);
+}
+
 TEST_CASE("[PackedScene] Can Instantiate Packed Scene") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
@@ -150,6 +223,100 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[SceneTree][PackedScene] Instantiate Packed Scene With Properties") {
+	// Create a scene to pack.
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(10, 20));
+	scene->set_z_index(3);
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_visible(false);
+	child->set_rotation(0.5);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Setters are resolved on the first instantiation and reused afterwards, so check more than one.
+	for (int i = 0; i < 3; i++) {
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene.instantiate());
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_position() == Vector2(10, 20));
+		CHECK(instance->get_z_index() == 3);
+
+		Node2D *instance_child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+		REQUIRE(instance_child != nullptr);
+		CHECK_FALSE(instance_child->is_visible());
+		CHECK(instance_child->get_rotation() == doctest::Approx(0.5));
+		memdelete(instance);
+	}
+
+	// Packing again must not reuse the previous setters.
+	child->set_rotation(1.0);
+	child->set_visible(true);
+	child->set_skew(0.25);
+	packed_scene.pack(scene);
+
+	Node *instance = packed_scene.instantiate();
+	Node2D *instance_child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+	REQUIRE(instance_child != nullptr);
+	CHECK(instance_child->is_visible());
+	CHECK(instance_child->get_rotation() == doctest::Approx(1.0));
+	CHECK(instance_child->get_skew() == doctest::Approx(0.25));
+
+	memdelete(scene);
+	memdelete(instance);
+}
+
+TEST_CASE("[PackedScene] Instantiate Packed Scene With Indexed And Dynamic Properties") {
+	GDREGISTER_CLASS(_TestPackedSceneNode);
+
+	_TestPackedSceneNode *scene = memnew(_TestPackedSceneNode);
+	scene->set_name("TestScene");
+	scene->set_value(Vector2(3, 4));
+	scene->set_indexed_value(1, 0.5);
+	scene->set("dynamic_value", 7);
+
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	for (int i = 0; i < 2; i++) {
+		_TestPackedSceneNode *instance = Object::cast_to<_TestPackedSceneNode>(packed_scene.instantiate());
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_value() == Vector2(3, 4));
+		CHECK(instance->get_indexed_value(0) == doctest::Approx(0.0));
+		CHECK(instance->get_indexed_value(1) == doctest::Approx(0.5));
+		CHECK(instance->get_dynamic_value() == 7);
+		memdelete(instance);
+	}
+
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][PackedScene] Instantiate Scene State With Converted Property Values") {
+	Ref<SceneState> state;
+	state.instantiate();
+	int root = state->add_node(-1, -1, state->add_name("Node2D"), state->add_name("TestScene"), -1, -1);
+	// Stored as an integer, but the property is a float.
+	state->add_node_property(root, state->add_name("rotation"), state->add_value(2));
+	state->add_node_property(root, state->add_name("z_index"), state->add_value(5));
+
+	PackedScene packed_scene;
+	packed_scene.replace_state(state);
+
+	for (int i = 0; i < 2; i++) {
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene.instantiate());
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_rotation() == doctest::Approx(2.0));
+		CHECK(instance->get_z_index() == 5);
+		memdelete(instance);
+	}
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
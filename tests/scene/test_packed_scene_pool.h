@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*  test_packed_scene_pool.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PACKED_SCENE_POOL_H
+#define TEST_PACKED_SCENE_POOL_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/main/scene_tree.h"
+#include "scene/resources/packed_scene_pool.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPackedScenePool {
+
+static Ref<PackedScene> make_scene() {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(1, 2));
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+	return packed_scene;
+}
+
+TEST_CASE("[SceneTree][PackedScenePool] Acquire and release") {
+	Ref<PackedScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(make_scene());
+
+	Node *first = pool->acquire();
+	REQUIRE(first != nullptr);
+	CHECK(pool->get_available_count() == 0);
+
+	pool->release(first);
+	CHECK(pool->get_available_count() == 1);
+
+	Node *second = pool->acquire();
+	CHECK_MESSAGE(second == first, "Released instances should be reused.");
+	CHECK(pool->get_available_count() == 0);
+
+	memdelete(second);
+}
+
+TEST_CASE("[SceneTree][PackedScenePool] Released instances are reset") {
+	Ref<PackedScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(make_scene());
+
+	Node *parent = memnew(Node);
+	Node2D *instance = Object::cast_to<Node2D>(pool->acquire());
+	REQUIRE(instance != nullptr);
+	parent->add_child(instance);
+
+	instance->set_position(Vector2(100, 200));
+	instance->set_rotation(1.0);
+	Node2D *child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+	child->set_visible(false);
+
+	pool->release(instance);
+	CHECK(instance->get_parent() == nullptr);
+	CHECK(parent->get_child_count() == 0);
+
+	Node2D *reused = Object::cast_to<Node2D>(pool->acquire());
+	REQUIRE(reused == instance);
+	CHECK(reused->get_position() == Vector2(1, 2));
+	CHECK(reused->get_rotation() == 0.0);
+	CHECK(child->is_visible());
+
+	memdelete(reused);
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][PackedScenePool] Instances with a different structure are not reused") {
+	Ref<PackedScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(make_scene());
+
+	Node *instance = pool->acquire();
+	instance->add_child(memnew(Node));
+	ObjectID instance_id = instance->get_instance_id();
+	pool->release(instance);
+	CHECK(pool->get_available_count() == 0);
+	CHECK_MESSAGE(ObjectDB::get_instance(instance_id) != nullptr, "Instances that can't be reused should be freed later, not while being released.");
+	SceneTree::get_singleton()->process(0.0);
+	CHECK(ObjectDB::get_instance(instance_id) == nullptr);
+
+	instance = pool->acquire();
+	memdelete(instance->get_node(NodePath("Child")));
+	pool->release(instance);
+	CHECK(pool->get_available_count() == 0);
+}
+
+TEST_CASE("[SceneTree][PackedScenePool] Capacity and prewarm") {
+	Ref<PackedScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(make_scene());
+	pool->set_capacity(4);
+
+	pool->prewarm(10);
+	CHECK(pool->get_available_count() == 4);
+
+	Node *instances[5];
+	for (int i = 0; i < 5; i++) {
+		instances[i] = pool->acquire();
+		REQUIRE(instances[i] != nullptr);
+	}
+	CHECK(pool->get_available_count() == 0);
+
+	for (int i = 0; i < 5; i++) {
+		pool->release(instances[i]);
+	}
+	CHECK_MESSAGE(pool->get_available_count() == 4, "Instances released while the pool is full should be freed.");
+
+	pool->set_capacity(2);
+	CHECK(pool->get_available_count() == 2);
+
+	pool->clear();
+	CHECK(pool->get_available_count() == 0);
+}
+
+} // namespace TestPackedScenePool
+
+#endif // TEST_PACKED_SCENE_POOL_H
@@ -0,0 +1,117 @@
+/**************************************************************************/
+/*  test_scene_instantiation_queue.h                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SCENE_INSTANTIATION_QUEUE_H
+#define TEST_SCENE_INSTANTIATION_QUEUE_H
+
+#include "core/os/os.h"
+#include "scene/resources/scene_instantiation_queue.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSceneInstantiationQueue {
+
+static Ref<PackedScene> make_scene(const String &p_name) {
+	Node *scene = memnew(Node);
+	scene->set_name(p_name);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+	return packed_scene;
+}
+
+TEST_CASE("[SceneInstantiationQueue] Instances are added in order") {
+	Ref<SceneInstantiationQueue> queue;
+	queue.instantiate();
+	Node *parent = memnew(Node);
+
+	queue->push(make_scene("First"), parent);
+	queue->push(make_scene("Second"), parent);
+	queue->push(make_scene("Third"), parent);
+	CHECK(queue->get_pending_count() == 3);
+
+	int added = 0;
+	for (int i = 0; i < 1000 && queue->get_pending_count() > 0; i++) {
+		added += queue->commit(0);
+		OS::get_singleton()->delay_usec(1000);
+	}
+	CHECK(added == 3);
+	CHECK(queue->get_pending_count() == 0);
+
+	REQUIRE(parent->get_child_count() == 3);
+	CHECK(parent->get_child(0)->get_name() == "First");
+	CHECK(parent->get_child(1)->get_name() == "Second");
+	CHECK(parent->get_child(2)->get_name() == "Third");
+	CHECK(parent->get_child(0)->get_node_or_null(NodePath("Child")) != nullptr);
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneInstantiationQueue] Instances of freed parents are discarded") {
+	Ref<SceneInstantiationQueue> queue;
+	queue.instantiate();
+	Node *parent = memnew(Node);
+
+	queue->push(make_scene("Scene"), parent);
+	memdelete(parent);
+
+	int added = 0;
+	for (int i = 0; i < 1000 && queue->get_pending_count() > 0; i++) {
+		added += queue->commit();
+		OS::get_singleton()->delay_usec(1000);
+	}
+	CHECK(added == 0);
+	CHECK(queue->get_pending_count() == 0);
+}
+
+TEST_CASE("[SceneInstantiationQueue] Clearing frees pending instances") {
+	Ref<SceneInstantiationQueue> queue;
+	queue.instantiate();
+	Node *parent = memnew(Node);
+
+	queue->push(make_scene("Scene"), parent);
+	queue->clear();
+	CHECK(queue->get_pending_count() == 0);
+	CHECK(queue->commit() == 0);
+	CHECK(parent->get_child_count() == 0);
+
+	memdelete(parent);
+}
+
+} // namespace TestSceneInstantiationQueue
+
+#endif // TEST_SCENE_INSTANTIATION_QUEUE_H
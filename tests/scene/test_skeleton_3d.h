@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*  test_skeleton_3d.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SKELETON_3D_H
+#define TEST_SKELETON_3D_H
+
+#include "scene/3d/skeleton_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSkeleton3D {
+
+static Transform3D reference_global_pose(Skeleton3D *p_skeleton, int p_bone) {
+	Transform3D pose = p_skeleton->is_bone_enabled(p_bone) && !p_skeleton->is_show_rest_only() ? p_skeleton->get_bone_pose(p_bone) : p_skeleton->get_bone_rest(p_bone);
+	int parent = p_skeleton->get_bone_parent(p_bone);
+	return parent >= 0 ? reference_global_pose(p_skeleton, parent) * pose : pose;
+}
+
+static bool global_poses_match(Skeleton3D *p_skeleton) {
+	for (int i = 0; i < p_skeleton->get_bone_count(); i++) {
+		if (!p_skeleton->get_bone_global_pose(i).is_equal_approx(reference_global_pose(p_skeleton, i))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("[SceneTree][Skeleton3D] Global pose propagation") {
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	SceneTree::get_singleton()->get_root()->add_child(skeleton);
+
+	// The root is added last, so bone indices are not in parent-before-child order.
+	const int hips = skeleton->add_bone("hips");
+	const int spine = skeleton->add_bone("spine");
+	const int arm_l = skeleton->add_bone("arm_l");
+	const int hand_l = skeleton->add_bone("hand_l");
+	const int arm_r = skeleton->add_bone("arm_r");
+	const int head = skeleton->add_bone("head");
+	const int root = skeleton->add_bone("root");
+	skeleton->set_bone_parent(hips, root);
+	skeleton->set_bone_parent(spine, hips);
+	skeleton->set_bone_parent(arm_l, spine);
+	skeleton->set_bone_parent(hand_l, arm_l);
+	skeleton->set_bone_parent(arm_r, spine);
+	skeleton->set_bone_parent(head, spine);
+
+	for (int i = 0; i < skeleton->get_bone_count(); i++) {
+		Transform3D rest(Basis(Vector3(0, 1, 0), 0.1 * i), Vector3(0, 0.5, 0.1 * i));
+		skeleton->set_bone_rest(i, rest);
+		skeleton->set_bone_pose_position(i, rest.origin);
+		skeleton->set_bone_pose_rotation(i, Quaternion(Vector3(1, 0, 0), 0.2 * i));
+		skeleton->set_bone_pose_scale(i, Vector3(1, 1, 1) * (1.0 + 0.05 * i));
+	}
+	CHECK(global_poses_match(skeleton));
+
+	SUBCASE("Changing a pose updates its subtree") {
+		skeleton->set_bone_pose_rotation(arm_l, Quaternion(Vector3(0, 0, 1), 1.2));
+		CHECK(global_poses_match(skeleton));
+
+		// Poses changed in separate subtrees before the next update.
+		skeleton->set_bone_pose_position(hand_l, Vector3(0.3, 0.2, 0.1));
+		skeleton->set_bone_pose_position(head, Vector3(0, 0.7, 0));
+		CHECK(global_poses_match(skeleton));
+
+		skeleton->set_bone_pose_scale(root, Vector3(2, 2, 2));
+		CHECK(global_poses_match(skeleton));
+	}
+
+	SUBCASE("Disabled bones and rest only use the rest") {
+		skeleton->set_bone_enabled(spine, false);
+		CHECK(global_poses_match(skeleton));
+		skeleton->set_bone_enabled(spine, true);
+		skeleton->set_show_rest_only(true);
+		CHECK(global_poses_match(skeleton));
+		CHECK(skeleton->get_bone_global_pose(hand_l).is_equal_approx(skeleton->get_bone_global_rest(hand_l)));
+		skeleton->set_show_rest_only(false);
+		CHECK(global_poses_match(skeleton));
+	}
+
+	SUBCASE("Reparenting bones") {
+		skeleton->set_bone_parent(arm_r, head);
+		CHECK(global_poses_match(skeleton));
+		skeleton->set_bone_parent(hand_l, -1);
+		skeleton->set_bone_pose_rotation(arm_l, Quaternion(Vector3(0, 1, 0), -0.4));
+		CHECK(global_poses_match(skeleton));
+		CHECK(skeleton->get_parentless_bones().size() == 2);
+	}
+
+	memdelete(skeleton);
+}
+
+} // namespace TestSkeleton3D
+
+#endif // TEST_SKELETON_3D_H
@@ -0,0 +1,239 @@
+/**************************************************************************/
+/*  test_cpu_skinning.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_CPU_SKINNING_H
+#define TEST_CPU_SKINNING_H
+
+#include "servers/rendering/cpu_skinning.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCPUSkinning {
+
+TEST_CASE("[CPUSkinning] Blend shapes") {
+	const Vector3 vertices[2] = { Vector3(0, 0, 0), Vector3(1, 0, 0) };
+	const Vector3 normals[2] = { Vector3(0, 1, 0), Vector3(0, 1, 0) };
+	const float tangents[8] = { 1, 0, 0, -1, 1, 0, 0, 1 };
+
+	CPUSkinning::Surface surface;
+	surface.vertex_count = 2;
+	surface.vertices = vertices;
+	surface.normals = normals;
+	surface.tangents = tangents;
+
+	Vector3 out_vertices[2];
+	Vector3 out_normals[2];
+	float out_tangents[8];
+	CPUSkinning::Output output;
+	output.vertices = out_vertices;
+	output.normals = out_normals;
+	output.tangents = out_tangents;
+
+	SUBCASE("Normalized") {
+		const Vector3 shape_vertices[2] = { Vector3(0, 2, 0), Vector3(1, 2, 0) };
+		const Vector3 shape_normals[2] = { Vector3(1, 0, 0), Vector3(1, 0, 0) };
+		const float shape_tangents[8] = { 0, 0, 1, 1, 0, 0, 1, 1 };
+
+		CPUSkinning::BlendShape shapes[2];
+		shapes[0].vertices = shape_vertices;
+		shapes[0].normals = shape_normals;
+		shapes[0].tangents = shape_tangents;
+		shapes[0].weight = 0.5;
+		// Shapes without influence are ignored, even without data.
+		shapes[1].weight = 0.0;
+
+		CPUSkinning::blend_shapes(surface, RS::BLEND_SHAPE_MODE_NORMALIZED, shapes, 2, output);
+
+		CHECK(out_vertices[0].is_equal_approx(Vector3(0, 1, 0)));
+		CHECK(out_vertices[1].is_equal_approx(Vector3(1, 1, 0)));
+		CHECK(out_normals[0].is_equal_approx(Vector3(0.5, 0.5, 0)));
+		CHECK(out_tangents[0] == doctest::Approx(0.5));
+		CHECK(out_tangents[2] == doctest::Approx(0.5));
+		CHECK_MESSAGE(out_tangents[3] == doctest::Approx(-1), "The binormal sign should not be blended.");
+		CHECK(out_tangents[7] == doctest::Approx(1));
+	}
+
+	SUBCASE("Relative") {
+		const Vector3 shape_vertices[2] = { Vector3(0, 2, 0), Vector3(0, -2, 0) };
+
+		CPUSkinning::BlendShape shape;
+		shape.vertices = shape_vertices;
+		shape.weight = 0.25;
+
+		CPUSkinning::blend_shapes(surface, RS::BLEND_SHAPE_MODE_RELATIVE, &shape, 1, output);
+
+		CHECK(out_vertices[0].is_equal_approx(Vector3(0, 0.5, 0)));
+		CHECK(out_vertices[1].is_equal_approx(Vector3(1, -0.5, 0)));
+		CHECK_MESSAGE(out_normals[0].is_equal_approx(Vector3(0, 1, 0)), "Shapes without normals should leave them untouched.");
+	}
+
+	SUBCASE("In place") {
+		Vector3 in_place[2] = { Vector3(0, 0, 0), Vector3(1, 0, 0) };
+		const Vector3 shape_vertices[2] = { Vector3(0, 0, 4), Vector3(1, 0, 4) };
+
+		CPUSkinning::BlendShape shape;
+		shape.vertices = shape_vertices;
+		shape.weight = 1.0;
+
+		surface.vertices = in_place;
+		surface.normals = nullptr;
+		surface.tangents = nullptr;
+		CPUSkinning::Output in_place_output;
+		in_place_output.vertices = in_place;
+
+		CPUSkinning::blend_shapes(surface, RS::BLEND_SHAPE_MODE_NORMALIZED, &shape, 1, in_place_output);
+
+		CHECK(in_place[0].is_equal_approx(Vector3(0, 0, 4)));
+		CHECK(in_place[1].is_equal_approx(Vector3(1, 0, 4)));
+	}
+}
+
+TEST_CASE("[CPUSkinning] Skinning") {
+	float bone_transforms[2 * CPUSkinning::BONE_STRIDE_3D];
+	CPUSkinning::store_bone_transform(Transform3D(Basis(), Vector3(0, 10, 0)), &bone_transforms[0]);
+	CPUSkinning::store_bone_transform(Transform3D(Basis(Vector3(0, 0, 1), Math_PI / 2), Vector3()), &bone_transforms[CPUSkinning::BONE_STRIDE_3D]);
+
+	const Vector3 vertices[3] = { Vector3(1, 0, 0), Vector3(1, 0, 0), Vector3(1, 0, 0) };
+	const Vector3 normals[3] = { Vector3(1, 0, 0), Vector3(1, 0, 0), Vector3(1, 0, 0) };
+	const float tangents[12] = { 0, 1, 0, -1, 0, 1, 0, -1, 0, 1, 0, -1 };
+	const int bones[12] = { 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0 };
+	const float weights[12] = { 1, 0, 0, 0, 1, 0, 0, 0, 0.5, 0.5, 0, 0 };
+
+	CPUSkinning::Surface surface;
+	surface.vertex_count = 3;
+	surface.vertices = vertices;
+	surface.normals = normals;
+	surface.tangents = tangents;
+
+	CPUSkinning::Skin skin;
+	skin.bones = bones;
+	skin.weights = weights;
+	skin.influences = 4;
+	skin.bone_transforms = bone_transforms;
+	skin.bone_count = 2;
+
+	Vector3 out_vertices[3];
+	Vector3 out_normals[3];
+	float out_tangents[12];
+	CPUSkinning::Output output;
+	output.vertices = out_vertices;
+	output.normals = out_normals;
+	output.tangents = out_tangents;
+
+	CPUSkinning::skin(surface, skin, output);
+
+	CHECK(out_vertices[0].is_equal_approx(Vector3(1, 10, 0)));
+	CHECK(out_normals[0].is_equal_approx(Vector3(1, 0, 0)));
+
+	CHECK(out_vertices[1].is_equal_approx(Vector3(0, 1, 0)));
+	CHECK(out_normals[1].is_equal_approx(Vector3(0, 1, 0)));
+	CHECK(Vector3(out_tangents[4], out_tangents[5], out_tangents[6]).is_equal_approx(Vector3(-1, 0, 0)));
+	CHECK(out_tangents[7] == doctest::Approx(-1));
+
+	// Bone matrices are blended, then normals are renormalized.
+	CHECK(out_vertices[2].is_equal_approx(Vector3(0.5, 5.5, 0)));
+	CHECK(out_normals[2].is_equal_approx(Vector3(1, 1, 0).normalized()));
+}
+
+TEST_CASE("[CPUSkinning] Multithreaded skinning matches single threaded") {
+	const uint32_t vertex_count = CPUSkinning::BLOCK_SIZE * 3 + 17;
+	const uint32_t bone_count = 16;
+
+	LocalVector<float> bone_transforms;
+	bone_transforms.resize(bone_count * CPUSkinning::BONE_STRIDE_3D);
+	for (uint32_t i = 0; i < bone_count; i++) {
+		Transform3D xform(Basis(Vector3(0, 1, 0), i * 0.3), Vector3(i, -(float)i, i * 0.5));
+		CPUSkinning::store_bone_transform(xform, &bone_transforms[i * CPUSkinning::BONE_STRIDE_3D]);
+	}
+
+	LocalVector<Vector3> vertices;
+	LocalVector<int> bones;
+	LocalVector<float> weights;
+	vertices.resize(vertex_count);
+	bones.resize(vertex_count * 8);
+	weights.resize(vertex_count * 8);
+	for (uint32_t i = 0; i < vertex_count; i++) {
+		vertices[i] = Vector3(i % 7, i % 13, i % 5);
+		for (uint32_t j = 0; j < 8; j++) {
+			bones[i * 8 + j] = (i + j * 3) % bone_count;
+			weights[i * 8 + j] = 1.0 / 8.0;
+		}
+	}
+
+	CPUSkinning::Surface surface;
+	surface.vertex_count = vertex_count;
+	surface.vertices = vertices.ptr();
+
+	CPUSkinning::Skin skin;
+	skin.bones = bones.ptr();
+	skin.weights = weights.ptr();
+	skin.influences = 8;
+	skin.bone_transforms = bone_transforms.ptr();
+	skin.bone_count = bone_count;
+
+	LocalVector<Vector3> single;
+	LocalVector<Vector3> multi;
+	single.resize(vertex_count);
+	multi.resize(vertex_count);
+
+	CPUSkinning::Output output;
+	output.vertices = single.ptr();
+	CPUSkinning::skin(surface, skin, output, false);
+	output.vertices = multi.ptr();
+	CPUSkinning::skin(surface, skin, output, true);
+
+	bool matches = true;
+	for (uint32_t i = 0; i < vertex_count; i++) {
+		matches = matches && single[i] == multi[i];
+	}
+	CHECK(matches);
+}
+
+TEST_CASE("[CPUSkinning] Skinned AABB") {
+	float bone_transforms[2 * CPUSkinning::BONE_STRIDE_3D];
+	CPUSkinning::store_bone_transform(Transform3D(Basis(), Vector3(0, 10, 0)), &bone_transforms[0]);
+	CPUSkinning::store_bone_transform(Transform3D(), &bone_transforms[CPUSkinning::BONE_STRIDE_3D]);
+
+	AABB bone_aabbs[2] = { AABB(Vector3(0, 0, 0), Vector3(1, 1, 1)), AABB(Vector3(-1, -1, -1), Vector3(-1, -1, -1)) };
+
+	AABB aabb;
+	CHECK(CPUSkinning::skin_aabb(bone_aabbs, 2, bone_transforms, false, Transform3D(), aabb));
+	CHECK_MESSAGE(aabb.is_equal_approx(AABB(Vector3(0, 10, 0), Vector3(1, 1, 1))), "Unused bones should be skipped.");
+
+	bone_aabbs[0] = bone_aabbs[1];
+	AABB untouched(Vector3(1, 2, 3), Vector3(1, 1, 1));
+	aabb = untouched;
+	CHECK_FALSE(CPUSkinning::skin_aabb(bone_aabbs, 2, bone_transforms, false, Transform3D(), aabb));
+	CHECK(aabb.is_equal_approx(untouched));
+}
+
+} // namespace TestCPUSkinning
+
+#endif // TEST_CPU_SKINNING_H
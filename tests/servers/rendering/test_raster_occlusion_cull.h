@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*  test_raster_occlusion_cull.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RASTER_OCCLUSION_CULL_H
+#define TEST_RASTER_OCCLUSION_CULL_H
+
+#include "servers/rendering/raster_occlusion_cull.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRasterOcclusionCull {
+
+typedef RasterOcclusionCull::RasterHZBuffer RasterHZBuffer;
+
+static bool is_box_occluded(const RasterHZBuffer &p_buffer, const AABB &p_box, const Transform3D &p_cam_transform, const Projection &p_cam_projection) {
+	real_t bounds[6] = { p_box.position.x, p_box.position.y, p_box.position.z, p_box.get_end().x, p_box.get_end().y, p_box.get_end().z };
+	uint64_t timeout = 0;
+	return p_buffer.is_occluded(bounds, p_cam_transform.origin, p_cam_transform.affine_inverse(), p_cam_projection, p_cam_projection.get_z_near(), timeout);
+}
+
+TEST_CASE("[RasterOcclusionCull] Rasterized occluders hide what's behind them") {
+	// A 10x10 wall, 10 units in front of the camera, with the camera looking down -Z.
+	const Vector3 vertices[4] = { Vector3(-5, -5, -10), Vector3(5, -5, -10), Vector3(5, 5, -10), Vector3(-5, 5, -10) };
+	const uint32_t indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+	RasterHZBuffer::Mesh mesh;
+	mesh.vertices = vertices;
+	mesh.indices = indices;
+	mesh.index_count = 6;
+
+	RasterHZBuffer buffer;
+	buffer.resize(Size2i(80, 60));
+
+	SUBCASE("Perspective camera") {
+		Projection projection;
+		projection.set_perspective(60, 4.0 / 3.0, 0.05, 100);
+		Transform3D camera_transform;
+		buffer.rasterize(&mesh, 1, camera_transform, projection);
+
+		CHECK_MESSAGE(is_box_occluded(buffer, AABB(Vector3(-1, -1, -30), Vector3(2, 2, 2)), camera_transform, projection), "Box behind the wall should be occluded.");
+		CHECK_FALSE_MESSAGE(is_box_occluded(buffer, AABB(Vector3(-1, -1, -6), Vector3(2, 2, 2)), camera_transform, projection), "Box in front of the wall should be visible.");
+		CHECK_FALSE_MESSAGE(is_box_occluded(buffer, AABB(Vector3(20, -1, -40), Vector3(2, 2, 2)), camera_transform, projection), "Box beside the wall should be visible.");
+		CHECK_FALSE_MESSAGE(is_box_occluded(buffer, AABB(Vector3(-20, -1, -30), Vector3(40, 2, 2)), camera_transform, projection), "Box wider than the wall should be visible.");
+	}
+
+	SUBCASE("Camera close to the wall, so it crosses the near plane") {
+		Projection projection;
+		projection.set_perspective(60, 4.0 / 3.0, 0.05, 100);
+		Transform3D camera_transform;
+		camera_transform.origin = Vector3(0, 0, -9.5);
+		// Looking sideways along the wall, most of it is behind the near plane.
+		camera_transform.basis = Basis(Vector3(0, 1, 0), Math::deg_to_rad(60.0));
+		buffer.rasterize(&mesh, 1, camera_transform, projection);
+
+		CHECK_MESSAGE(is_box_occluded(buffer, AABB(Vector3(-5, -0.5, -15), Vector3(1, 1, 1)), camera_transform, projection), "Box behind the wall should be occluded.");
+		CHECK_FALSE_MESSAGE(is_box_occluded(buffer, AABB(Vector3(-3, -0.5, -9), Vector3(1, 1, 1)), camera_transform, projection), "Box in front of the wall should be visible.");
+	}
+
+	SUBCASE("Orthogonal camera") {
+		Projection projection;
+		projection.set_orthogonal(-10, 10, -7.5, 7.5, 0.05, 100);
+		Transform3D camera_transform;
+		buffer.rasterize(&mesh, 1, camera_transform, projection);
+
+		CHECK(is_box_occluded(buffer, AABB(Vector3(-1, -1, -30), Vector3(2, 2, 2)), camera_transform, projection));
+		CHECK_FALSE(is_box_occluded(buffer, AABB(Vector3(7, -1, -30), Vector3(2, 2, 2)), camera_transform, projection));
+	}
+
+	SUBCASE("No occluders") {
+		Projection projection;
+		projection.set_perspective(60, 4.0 / 3.0, 0.05, 100);
+		Transform3D camera_transform;
+		buffer.rasterize(&mesh, 1, camera_transform, projection);
+		buffer.rasterize(nullptr, 0, camera_transform, projection);
+
+		CHECK_FALSE_MESSAGE(is_box_occluded(buffer, AABB(Vector3(-1, -1, -30), Vector3(2, 2, 2)), camera_transform, projection), "Previous frame's occluders should have been cleared.");
+	}
+}
+
+} // namespace TestRasterOcclusionCull
+
+#endif // TEST_RASTER_OCCLUSION_CULL_H
@@ -0,0 +1,393 @@
+/**************************************************************************/
+/*  test_renderer_scene_cull.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RENDERER_SCENE_CULL_H
+#define TEST_RENDERER_SCENE_CULL_H
+
+#include "core/math/geometry_3d.h"
+#include "core/math/projection.h"
+#include "core/math/random_number_generator.h"
+#include "servers/rendering/renderer_scene_cull.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRendererSceneCull {
+
+typedef RendererSceneCull::Instance Instance;
+typedef RendererSceneCull::InstanceBounds InstanceBounds;
+typedef RendererSceneCull::InstanceBoundsBlock InstanceBoundsBlock;
+typedef RendererSceneCull::InstanceGeometryData InstanceGeometryData;
+typedef RendererSceneCull::InstanceLightData InstanceLightData;
+typedef RendererSceneCull::Scenario Scenario;
+typedef RendererSceneCull::ShadowCasterCache ShadowCasterCache;
+
+struct ShadowPass {
+	Vector<Plane> planes;
+	uint32_t visible_layers = 1;
+	int pass = 0;
+};
+
+// Culls the casters of a light pass the way it was done on the render thread, one pass at a time.
+static LocalVector<RenderGeometryInstance *> cull_shadow_casters_serial(Scenario &p_scenario, const ShadowPass &p_pass) {
+	Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(p_pass.planes.ptr(), p_pass.planes.size());
+
+	struct CullConvex {
+		LocalVector<Instance *> *result;
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			result->push_back((Instance *)p_data);
+			return false;
+		}
+	};
+
+	LocalVector<Instance *> instances;
+	CullConvex cull_convex;
+	cull_convex.result = &instances;
+	p_scenario.indexers[Scenario::INDEXER_GEOMETRY].convex_query(p_pass.planes.ptr(), p_pass.planes.size(), points.ptr(), points.size(), cull_convex);
+
+	LocalVector<RenderGeometryInstance *> casters;
+	for (Instance *instance : instances) {
+		InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(instance->base_data);
+		if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !geom->can_cast_shadows || !(p_pass.visible_layers & instance->layer_mask)) {
+			continue;
+		}
+		casters.push_back(geom->geometry_instance);
+	}
+	return casters;
+}
+
+static bool casters_match(const LocalVector<RenderGeometryInstance *> &p_a, const LocalVector<RenderGeometryInstance *> &p_b) {
+	if (p_a.size() != p_b.size()) {
+		return false;
+	}
+	for (uint32_t i = 0; i < p_a.size(); i++) {
+		if (p_a[i] != p_b[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void cull_shadow_casters_threaded(RendererSceneCull *p_scene_cull, Scenario &p_scenario, InstanceLightData &p_light, const LocalVector<ShadowPass> &p_passes, LocalVector<LocalVector<RenderGeometryInstance *>> &r_casters) {
+	p_scene_cull->max_shadows_used = 0;
+	for (const ShadowPass &pass : p_passes) {
+		p_scene_cull->_add_shadow_cull_task(&p_light, pass.planes, &p_scenario, pass.visible_layers, pass.pass);
+	}
+	p_scene_cull->_process_shadow_cull_tasks();
+
+	r_casters.clear();
+	r_casters.resize(p_passes.size());
+	for (uint32_t i = 0; i < p_passes.size(); i++) {
+		RendererSceneRender::RenderShadowData &shadow_data = p_scene_cull->render_shadow_data[i];
+		CHECK(shadow_data.pass == p_passes[i].pass);
+		for (uint64_t j = 0; j < shadow_data.instances.size(); j++) {
+			r_casters[i].push_back(shadow_data.instances[j]);
+		}
+		shadow_data.instances.clear();
+	}
+	p_scene_cull->max_shadows_used = 0;
+}
+
+TEST_CASE("[RendererSceneCull] Blocked frustum test matches per-instance test") {
+	Projection projection;
+	projection.set_perspective(70, 16.0 / 9.0, 0.05, 100.0);
+	Transform3D camera_transform = Transform3D().looking_at(Vector3(1, -0.5, -2));
+	camera_transform.origin = Vector3(3, 2, 1);
+	RendererSceneCull::Frustum frustum(projection.get_projection_planes(camera_transform));
+
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(7);
+
+	uint32_t visible = 0;
+	for (uint32_t i = 0; i < 64; i++) {
+		InstanceBounds bounds[InstanceBoundsBlock::SIZE];
+		InstanceBoundsBlock block;
+		for (uint32_t j = 0; j < InstanceBoundsBlock::SIZE; j++) {
+			Vector3 position(rng->randf_range(-100, 100), rng->randf_range(-100, 100), rng->randf_range(-100, 100));
+			Vector3 size(rng->randf_range(0, 10), rng->randf_range(0, 10), rng->randf_range(0, 10));
+			bounds[j] = InstanceBounds(AABB(position, size));
+			block.set(j, bounds[j]);
+		}
+
+		uint32_t mask = block.in_frustum(frustum);
+		for (uint32_t j = 0; j < InstanceBoundsBlock::SIZE; j++) {
+			CHECK(bool(mask & (1 << j)) == bounds[j].in_frustum(frustum));
+			visible += bounds[j].in_frustum(frustum);
+		}
+	}
+
+	// Make sure both outcomes were actually tested.
+	CHECK(visible > 0);
+	CHECK(visible < 64 * InstanceBoundsBlock::SIZE);
+}
+
+TEST_CASE("[RendererSceneCull] Shadow caster cache is only invalidated by caster changes") {
+	InstanceLightData light;
+	light.shadow_caster_cache = true;
+	ShadowCasterCache &cache = light.shadow_caster_caches[0];
+
+	CHECK_FALSE_MESSAGE(cache.is_valid(light.caster_version, 1), "Empty cache should never be valid.");
+
+	// Simulate a full cull storing its result.
+	light.make_shadow_dirty();
+	light.decrement_shadow_dirty();
+	CHECK_MESSAGE(light.is_shadow_update_full(), "Lights caching their casters should never use camera-dependent culling.");
+	cache.caster_version = light.caster_version;
+	cache.visible_layers = 1;
+
+	uint32_t cull_count = 0;
+	for (int i = 0; i < 10; i++) {
+		// Redraws without caster changes (animated materials, atlas slot changes) reuse the casters.
+		light.make_shadow_dirty(false);
+		light.decrement_shadow_dirty();
+		if (!cache.is_valid(light.caster_version, 1)) {
+			cull_count++;
+			cache.caster_version = light.caster_version;
+		}
+	}
+	CHECK(cull_count == 0);
+
+	CHECK_FALSE_MESSAGE(cache.is_valid(light.caster_version, 2), "A camera with different visible layers should not reuse the casters.");
+
+	// A caster moving, pairing or unpairing needs a new cull.
+	light.make_shadow_dirty();
+	CHECK_FALSE(cache.is_valid(light.caster_version, 1));
+
+	cache.reset();
+	CHECK(cache.instances.is_empty());
+	CHECK_FALSE(cache.is_valid(light.caster_version, 1));
+}
+
+TEST_CASE("[SceneTree][RendererSceneCull] Threaded shadow caster cull matches the serial cull") {
+	RendererSceneCull *scene_cull = RendererSceneCull::singleton;
+	REQUIRE(scene_cull != nullptr);
+
+	Scenario scenario;
+	LocalVector<Instance *> instances;
+
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(11);
+
+	for (uint32_t i = 0; i < 2000; i++) {
+		Instance *instance = memnew(Instance);
+		instance->base_type = RS::INSTANCE_MESH;
+		instance->visible = i % 7 != 0;
+		instance->layer_mask = 1 + i % 3;
+
+		InstanceGeometryData *geom = memnew(InstanceGeometryData);
+		geom->can_cast_shadows = i % 5 != 0;
+		geom->material_is_animated = false;
+		// Only compared, never dereferenced by culling.
+		geom->geometry_instance = reinterpret_cast<RenderGeometryInstance *>(uintptr_t(i + 1));
+		instance->base_data = geom;
+
+		Vector3 position(rng->randf_range(-60, 60), rng->randf_range(-60, 60), rng->randf_range(-60, 60));
+		Vector3 size(rng->randf_range(0.5, 4), rng->randf_range(0.5, 4), rng->randf_range(0.5, 4));
+		scenario.indexers[Scenario::INDEXER_GEOMETRY].insert(AABB(position, size), instance);
+		instances.push_back(instance);
+	}
+
+	Transform3D light_transform = Transform3D().looking_at(Vector3(0.3, -1, 0.2));
+	light_transform.origin = Vector3(5, 10, -3);
+	const real_t radius = 40.0;
+
+	LocalVector<ShadowPass> passes;
+
+	// Directional cascades are culled along with the camera, but their orthogonal volumes are culled the same way.
+	const real_t cascade_splits[4] = { 5, 15, 40, 80 };
+	for (int i = 0; i < 4; i++) {
+		Projection ortho;
+		ortho.set_orthogonal(-cascade_splits[i], cascade_splits[i], -cascade_splits[i], cascade_splits[i], 0, 200);
+		Transform3D cascade_transform = light_transform;
+		cascade_transform.origin = light_transform.basis.get_column(2) * 100;
+		ShadowPass pass;
+		pass.planes = ortho.get_projection_planes(cascade_transform);
+		pass.pass = i;
+		passes.push_back(pass);
+	}
+
+	// Omni light, cube faces.
+	Projection cube;
+	cube.set_perspective(90, 1, radius * 0.005f, radius);
+	static const Vector3 view_normals[6] = { Vector3(+1, 0, 0), Vector3(-1, 0, 0), Vector3(0, -1, 0), Vector3(0, +1, 0), Vector3(0, 0, +1), Vector3(0, 0, -1) };
+	static const Vector3 view_up[6] = { Vector3(0, -1, 0), Vector3(0, -1, 0), Vector3(0, 0, -1), Vector3(0, 0, +1), Vector3(0, -1, 0), Vector3(0, -1, 0) };
+	for (int i = 0; i < 6; i++) {
+		ShadowPass pass;
+		pass.planes = cube.get_projection_planes(light_transform * Transform3D().looking_at(view_normals[i], view_up[i]));
+		pass.pass = i;
+		passes.push_back(pass);
+	}
+
+	// Omni light, dual paraboloid halves.
+	for (int i = 0; i < 2; i++) {
+		real_t z = i == 0 ? -1 : 1;
+		ShadowPass pass;
+		pass.planes.resize(6);
+		pass.planes.write[0] = light_transform.xform(Plane(Vector3(0, 0, z), radius));
+		pass.planes.write[1] = light_transform.xform(Plane(Vector3(1, 0, z).normalized(), radius));
+		pass.planes.write[2] = light_transform.xform(Plane(Vector3(-1, 0, z).normalized(), radius));
+		pass.planes.write[3] = light_transform.xform(Plane(Vector3(0, 1, z).normalized(), radius));
+		pass.planes.write[4] = light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius));
+		pass.planes.write[5] = light_transform.xform(Plane(Vector3(0, 0, -z), 0));
+		pass.pass = i;
+		passes.push_back(pass);
+	}
+
+	// Spot lights, one of them seeing a different set of layers.
+	for (int i = 0; i < 2; i++) {
+		Projection spot;
+		spot.set_perspective(45.0 * 2.0, 1.0, 0.005f * radius, radius);
+		ShadowPass pass;
+		pass.planes = spot.get_projection_planes(light_transform);
+		pass.visible_layers = i == 0 ? 1 : 2;
+		passes.push_back(pass);
+	}
+
+	LocalVector<LocalVector<RenderGeometryInstance *>> expected;
+	uint32_t total_casters = 0;
+	for (const ShadowPass &pass : passes) {
+		expected.push_back(cull_shadow_casters_serial(scenario, pass));
+		total_casters += expected[expected.size() - 1].size();
+	}
+	// Make sure the volumes actually contain casters, and that some are filtered out.
+	CHECK(total_casters > 0);
+	CHECK(total_casters < instances.size() * passes.size());
+
+	InstanceLightData light;
+	light.decrement_shadow_dirty(); // Full update, casters aren't culled against the camera.
+	REQUIRE(light.is_shadow_update_full());
+
+	LocalVector<LocalVector<RenderGeometryInstance *>> casters;
+
+	SUBCASE("Without caster cache") {
+		cull_shadow_casters_threaded(scene_cull, scenario, light, passes, casters);
+		for (uint32_t i = 0; i < passes.size(); i++) {
+			CHECK_MESSAGE(casters_match(casters[i], expected[i]), "Casters of pass ", i, " should match the serial cull.");
+		}
+	}
+
+	SUBCASE("With caster cache") {
+		// Cached passes are keyed by pass index, so only use one light's worth of passes at a time.
+		light.shadow_caster_cache = true;
+		light.make_shadow_dirty();
+		light.decrement_shadow_dirty();
+
+		LocalVector<ShadowPass> cube_passes;
+		for (uint32_t i = 4; i < 10; i++) {
+			cube_passes.push_back(passes[i]);
+		}
+
+		for (int frame = 0; frame < 2; frame++) {
+			cull_shadow_casters_threaded(scene_cull, scenario, light, cube_passes, casters);
+			for (uint32_t i = 0; i < cube_passes.size(); i++) {
+				CHECK_MESSAGE(casters_match(casters[i], expected[i + 4]), "Casters of cube face ", i, " should match the serial cull on frame ", frame, ".");
+				CHECK(light.shadow_caster_caches[i].is_valid(light.caster_version, 1));
+			}
+		}
+	}
+
+	for (Instance *instance : instances) {
+		memdelete(instance);
+	}
+}
+
+TEST_CASE("[SceneTree][RendererSceneCull] Batched transforms match per-instance transforms") {
+	RendererSceneCull *scene_cull = RendererSceneCull::singleton;
+	REQUIRE(scene_cull != nullptr);
+
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(13);
+
+	Vector<RID> single;
+	Vector<RID> batched;
+	Vector<Transform3D> transforms;
+	for (int i = 0; i < 32; i++) {
+		for (Vector<RID> *instances : { &single, &batched }) {
+			RID instance = scene_cull->instance_allocate();
+			scene_cull->instance_initialize(instance);
+			instances->push_back(instance);
+		}
+
+		// Some instances keep their current transform, which should not queue them for an update.
+		Transform3D transform;
+		if (i % 4 != 0) {
+			transform.basis = Basis(Vector3(rng->randf_range(-1, 1), rng->randf_range(-1, 1), 1).normalized(), rng->randf_range(-Math_PI, Math_PI));
+			transform.origin = Vector3(rng->randf_range(-100, 100), rng->randf_range(-100, 100), rng->randf_range(-100, 100));
+		}
+		transforms.push_back(transform);
+	}
+	scene_cull->update_dirty_instances();
+
+	for (int i = 0; i < single.size(); i++) {
+		scene_cull->instance_set_transform(single[i], transforms[i]);
+	}
+	scene_cull->instance_set_transforms(batched, transforms);
+
+	for (int i = 0; i < single.size(); i++) {
+		Instance *a = scene_cull->instance_owner.get_or_null(single[i]);
+		Instance *b = scene_cull->instance_owner.get_or_null(batched[i]);
+		CHECK(a->transform == b->transform);
+		CHECK(b->transform == transforms[i]);
+		CHECK(a->update_item.in_list() == b->update_item.in_list());
+		CHECK(b->update_item.in_list() == (i % 4 != 0));
+	}
+	scene_cull->update_dirty_instances();
+
+	SUBCASE("Invalid instances are skipped") {
+		Vector<RID> instances = { batched[0], RID(), batched[1] };
+		Vector<Transform3D> moved = { Transform3D(Basis(), Vector3(1, 0, 0)), Transform3D(), Transform3D(Basis(), Vector3(2, 0, 0)) };
+		ERR_PRINT_OFF;
+		scene_cull->instance_set_transforms(instances, moved);
+		ERR_PRINT_ON;
+		CHECK(scene_cull->instance_owner.get_or_null(batched[0])->transform == moved[0]);
+		CHECK(scene_cull->instance_owner.get_or_null(batched[1])->transform == moved[2]);
+	}
+
+	SUBCASE("Mismatched sizes don't change any instance") {
+		Vector<Transform3D> moved = { Transform3D(Basis(), Vector3(1, 0, 0)) };
+		ERR_PRINT_OFF;
+		scene_cull->instance_set_transforms(batched, moved);
+		ERR_PRINT_ON;
+		CHECK(scene_cull->instance_owner.get_or_null(batched[0])->transform == transforms[0]);
+		CHECK_FALSE(scene_cull->instance_owner.get_or_null(batched[0])->update_item.in_list());
+	}
+
+	scene_cull->update_dirty_instances();
+	for (int i = 0; i < single.size(); i++) {
+		scene_cull->free(single[i]);
+		scene_cull->free(batched[i]);
+	}
+}
+
+} // namespace TestRendererSceneCull
+
+#endif // TEST_RENDERER_SCENE_CULL_H